@@ -66,6 +66,7 @@ SOURCES += \
     src/streamchannel.cpp \
     src/channelinfomodel.cpp \
     src/ringbuffer.cpp \
+    src/compressedbuffer.cpp \
     src/indexbuffer.cpp \
     src/linindexbuffer.cpp \
     src/readonlybuffer.cpp \
@@ -96,7 +97,41 @@ SOURCES += \
     src/samplecounter.cpp \
     src/ledwidget.cpp \
     src/datatextview.cpp \
-    src/bpslabel.cpp
+    src/bpslabel.cpp \
+    src/mathexpression.cpp \
+    src/mathchannels.cpp \
+    src/mathpanel.cpp \
+    src/filter.cpp \
+    src/channelfilters.cpp \
+    src/filterpanel.cpp \
+    src/fft.cpp \
+    src/spectrumanalyzer.cpp \
+    src/spectrumplot.cpp \
+    src/trigger.cpp \
+    src/triggercapture.cpp \
+    src/triggerpanel.cpp \
+    src/runningstats.cpp \
+    src/channelstats.cpp \
+    src/decimator.cpp \
+    src/asyncsink.cpp \
+    src/replotscheduler.cpp \
+    src/framebuffercurve.cpp \
+    src/curvecache.cpp \
+    src/lanescaledraw.cpp \
+    src/waterfallitem.cpp \
+    src/xycurve.cpp \
+    src/hitmap.cpp \
+    src/xyplot.cpp \
+    src/persistenceanalyzer.cpp \
+    src/densityitem.cpp \
+    src/persistenceplot.cpp \
+    src/rowring.cpp \
+    src/textrowview.cpp \
+    src/bytering.cpp \
+    src/hexview.cpp \
+    src/binaryrecording.cpp \
+    src/csvformatter.cpp \
+    src/compressedfile.cpp
 
 HEADERS += \
     src/mainwindow.h \
@@ -138,6 +173,41 @@ HEADERS += \
     src/demoreadersettings.h \
     src/datatextview.h \
     src/bpslabel.h \
+    src/mathexpression.h \
+    src/mathchannels.h \
+    src/mathpanel.h \
+    src/filter.h \
+    src/channelfilters.h \
+    src/filterpanel.h \
+    src/fft.h \
+    src/spectrumanalyzer.h \
+    src/spectrumplot.h \
+    src/trigger.h \
+    src/triggercapture.h \
+    src/triggerpanel.h \
+    src/runningstats.h \
+    src/channelstats.h \
+    src/decimator.h \
+    src/asyncsink.h \
+    src/replotscheduler.h \
+    src/framebuffercurve.h \
+    src/curvecache.h \
+    src/lanescaledraw.h \
+    src/waterfallitem.h \
+    src/xycurve.h \
+    src/hitmap.h \
+    src/xyplot.h \
+    src/colormap.h \
+    src/persistenceanalyzer.h \
+    src/densityitem.h \
+    src/persistenceplot.h \
+    src/rowring.h \
+    src/textrowview.h \
+    src/bytering.h \
+    src/hexview.h \
+    src/binaryrecording.h \
+    src/csvformatter.h \
+    src/compressedfile.h \
     src/barchart.h \
     src/barplot.h \
     src/barscaledraw.h \
@@ -150,6 +220,7 @@ HEADERS += \
     src/plotmenu.h \
     src/readonlybuffer.h \
     src/ringbuffer.h \
+    src/compressedbuffer.h \
     src/samplecounter.h \
     src/samplepack.h \
     src/scrollbar.h \
@@ -179,7 +250,10 @@ FORMS += \
     src/recordpanel.ui \
     src/updatecheckdialog.ui \
     src/demoreadersettings.ui \
-    src/datatextview.ui
+    src/datatextview.ui \
+    src/mathpanel.ui \
+    src/filterpanel.ui \
+    src/triggerpanel.ui
 
 INCLUDEPATH += qmake/ src/
 
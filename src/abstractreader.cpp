@@ -17,6 +17,9 @@
   along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <QtDebug>
+
 #include "abstractreader.h"
 
 AbstractReader::AbstractReader(QIODevice* device, QObject* parent) :
@@ -24,6 +27,12 @@ AbstractReader::AbstractReader(QIODevice* device, QObject* parent) :
 {
     _device = device;
     bytesRead = 0;
+    rawTap = nullptr;
+
+    errorLogTimer.setSingleShot(true);
+    errorLogTimer.setInterval(ERROR_LOG_PERIOD);
+    connect(&errorLogTimer, &QTimer::timeout,
+            this, &AbstractReader::logErrors);
 }
 
 void AbstractReader::pause(bool enabled)
@@ -47,7 +56,38 @@ void AbstractReader::enable(bool enabled)
 
 void AbstractReader::onDataReady()
 {
-    bytesRead += readData();
+    if (rawTap == nullptr)
+    {
+        bytesRead += readData();
+        return;
+    }
+
+    // peek the bytes before reader consumes them
+    QByteArray raw = _device->peek(_device->bytesAvailable());
+    rawMarks.clear();
+    unsigned n = readData();
+    bytesRead += n;
+
+    n = std::min(n, unsigned(raw.size()));
+    rawTap->append(raw.constData(), n);
+    quint64 start = rawTap->end() - n;
+    for (auto& m : rawMarks)
+    {
+        if (m.offset < n) rawTap->mark(start + m.offset, m.flags);
+    }
+}
+
+void AbstractReader::setRawTap(ByteRing* tap)
+{
+    rawTap = tap;
+}
+
+void AbstractReader::markRaw(unsigned offset, quint8 flags)
+{
+    if (rawTap != nullptr)
+    {
+        rawMarks.append({offset, flags});
+    }
 }
 
 unsigned AbstractReader::getBytesRead()
@@ -56,3 +96,76 @@ unsigned AbstractReader::getBytesRead()
     bytesRead = 0;
     return r;
 }
+
+QMap<QString, quint64> AbstractReader::errorCounts() const
+{
+    QMap<QString, quint64> r;
+    for (auto it = errors.cbegin(); it != errors.cend(); ++it)
+    {
+        r[it.key()] = it.value().total;
+    }
+    return r;
+}
+
+void AbstractReader::reportError(const QString& kind, const QString& example,
+                                 QtMsgType type)
+{
+    auto it = errors.find(kind);
+    if (it == errors.end())
+    {
+        it = errors.insert(kind, {type, 0, 0, QString()});
+    }
+
+    ErrorStat& stat = it.value();
+    stat.total++;
+    if (!stat.pending++)
+    {
+        stat.example = example.length() > MAX_EXAMPLE_LENGTH ?
+            example.left(MAX_EXAMPLE_LENGTH) + "..." : example;
+    }
+
+    // first error of a quiet period is logged right away
+    if (!errorLogTimer.isActive())
+    {
+        logErrors();
+    }
+}
+
+void AbstractReader::logErrors()
+{
+    bool logged = false;
+    for (auto it = errors.begin(); it != errors.end(); ++it)
+    {
+        ErrorStat& stat = it.value();
+        if (!stat.pending) continue;
+
+        QString msg = it.key();
+        if (stat.pending > 1)
+        {
+            msg += QString(" (%1 times)").arg(stat.pending);
+        }
+        if (!stat.example.isEmpty())
+        {
+            msg += ", e.g.: " + stat.example;
+        }
+
+        if (stat.type == QtCriticalMsg)
+        {
+            qCritical().noquote() << msg;
+        }
+        else
+        {
+            qWarning().noquote() << msg;
+        }
+
+        stat.pending = 0;
+        stat.example.clear();
+        logged = true;
+    }
+
+    // keep the timer running while errors keep coming
+    if (logged)
+    {
+        errorLogTimer.start();
+    }
+}
@@ -24,8 +24,12 @@
 #include <QIODevice>
 #include <QWidget>
 #include <QTimer>
+#include <QMap>
+#include <QString>
+#include <QVector>
 
 #include "source.h"
+#include "bytering.h"
 
 /**
  * All reader classes must inherit this class.
@@ -52,6 +56,16 @@ public:
     /// Read and 'zero' the byte counter
     unsigned getBytesRead();
 
+    /// Returns the number of errors reported so far, per error kind
+    QMap<QString, quint64> errorCounts() const;
+
+    /**
+     * Sets a ring buffer to copy the raw bytes consumed by the reader
+     * into. Set to `nullptr` to disable, which is the default. No
+     * copying is done when disabled.
+     */
+    void setRawTap(ByteRing* tap);
+
 signals:
     // TODO: should we keep this?
     void numOfChannelsChanged(unsigned);
@@ -80,11 +94,62 @@ protected:
      */
     virtual unsigned readData() = 0;
 
+    /**
+     * Reports a data error such as a malformed line or a failed
+     * checksum.
+     *
+     * Errors aren't logged immediately. They are counted per `kind`
+     * and logged at most once per `ERROR_LOG_PERIOD` along with the
+     * number of occurrences and the first `example` of the period. So
+     * a noisy line doesn't flood the log with a message per frame.
+     *
+     * @param kind short, constant description of the error
+     * @param example details of a particular occurrence
+     * @param type message type to log with
+     */
+    void reportError(const QString& kind, const QString& example,
+                     QtMsgType type = QtWarningMsg);
+
+    /**
+     * Marks a raw byte for display, such as a sync byte. Does nothing
+     * if raw tap isn't set.
+     *
+     * @param offset position of the byte counted from the first byte
+     * read in current `readData()` call
+     * @param flags combination of `ByteRing::Mark`
+     */
+    void markRaw(unsigned offset, quint8 flags);
+
 private:
+    /// Errors are logged at most once in this period (ms)
+    static const int ERROR_LOG_PERIOD = 1000;
+    /// Examples are cut to this length (characters)
+    static const int MAX_EXAMPLE_LENGTH = 120;
+
+    struct ErrorStat
+    {
+        QtMsgType type;
+        quint64 total;    ///< total number of occurrences
+        quint64 pending;  ///< occurrences not logged yet
+        QString example;  ///< first example since last log
+    };
+
+    struct RawMark
+    {
+        unsigned offset;
+        quint8 flags;
+    };
+
     unsigned bytesRead;
+    ByteRing* rawTap;
+    QVector<RawMark> rawMarks;  ///< marks of the current `readData()` call
+    QMap<QString, ErrorStat> errors;
+    QTimer errorLogTimer;
 
 private slots:
     void onDataReady();
+    /// Logs the pending errors
+    void logErrors();
 };
 
 #endif // ABSTRACTREADER_H
@@ -160,7 +160,7 @@ unsigned AsciiReader::readData()
     return numBytesRead;
 }
 
-SamplePack* AsciiReader::parseLine(const QString& line) const
+SamplePack* AsciiReader::parseLine(const QString& line)
 {
     auto separatedValues = line.split(delimiter, Qt::SkipEmptyParts);
     unsigned numComingChannels = separatedValues.length();
@@ -168,8 +168,7 @@ SamplePack* AsciiReader::parseLine(const QString& line) const
     // check number of channels (skipped if auto num channels is enabled)
     if ((!numComingChannels) || (!autoNumOfChannels && numComingChannels != _numChannels))
     {
-        qWarning() << "Line parsing error: invalid number of channels!";
-        qWarning() << "Read line: " << line;
+        reportError(tr("Line parsing error: invalid number of channels"), line);
         return nullptr;
     }
 
@@ -194,8 +193,8 @@ SamplePack* AsciiReader::parseLine(const QString& line) const
         }
         if (!ok)
         {
-            qWarning() << "Data parsing error for channel: " << ci;
-            qWarning() << "Read line: " << line;
+            reportError(tr("Data parsing error"),
+                        QString("channel %1, line: %2").arg(ci).arg(line));
 
             delete samples;
             return nullptr;
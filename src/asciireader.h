@@ -62,7 +62,7 @@ private slots:
      *
      * Returns `nullptr` in case of error.
      */
-    SamplePack* parseLine(const QString& line) const;
+    SamplePack* parseLine(const QString& line);
 };
 
 #endif // ASCIIREADER_H
@@ -0,0 +1,201 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <QDateTime>
+
+#include "asyncsink.h"
+
+AsyncSink::AsyncSink(unsigned capacity, Policy policy) :
+    capacity(capacity)
+{
+    Q_ASSERT(capacity > 0);
+
+    _policy = policy;
+    inFlight = 0;
+    _packTime = 0;
+    quit = false;
+    idleInterval = 0;
+    idleRunning = false;
+    maxDepth = 0;
+    dropped = 0;
+
+    thread = QThread::create([this]() {run();});
+    thread->start();
+}
+
+AsyncSink::~AsyncSink()
+{
+    {
+        QMutexLocker locker(&mutex);
+        quit = true;
+        notEmpty.wakeAll();
+    }
+    thread->wait();
+    delete thread;
+}
+
+void AsyncSink::setPolicy(Policy policy)
+{
+    QMutexLocker locker(&mutex);
+    _policy = policy;
+    notFull.wakeAll();
+}
+
+AsyncSink::Policy AsyncSink::policy() const
+{
+    QMutexLocker locker(&mutex);
+    return _policy;
+}
+
+void AsyncSink::flush()
+{
+    QMutexLocker locker(&mutex);
+    while (!queue.empty() || inFlight || idleRunning)
+    {
+        drained.wait(&mutex);
+    }
+}
+
+qint64 AsyncSink::packTime() const
+{
+    return _packTime;
+}
+
+void AsyncSink::setIdleHandler(unsigned intervalMs, std::function<void()> handler)
+{
+    QMutexLocker locker(&mutex);
+    while (idleRunning)
+    {
+        drained.wait(&mutex);
+    }
+    idleInterval = intervalMs;
+    idleHandler = handler;
+    notEmpty.wakeAll();         // restart waiting with the new interval
+}
+
+unsigned AsyncSink::queueDepth() const
+{
+    QMutexLocker locker(&mutex);
+    return queue.size() + inFlight;
+}
+
+unsigned AsyncSink::maxQueueDepth() const
+{
+    QMutexLocker locker(&mutex);
+    return maxDepth;
+}
+
+quint64 AsyncSink::numDropped() const
+{
+    QMutexLocker locker(&mutex);
+    return dropped;
+}
+
+void AsyncSink::resetStats()
+{
+    QMutexLocker locker(&mutex);
+    maxDepth = queue.size();
+    dropped = 0;
+}
+
+void AsyncSink::feedIn(const SamplePack& data)
+{
+    // copy outside of the lock
+    QueuedPack pack = {QSharedPointer<const SamplePack>(new SamplePack(data)),
+                       QDateTime::currentMSecsSinceEpoch()};
+
+    QMutexLocker locker(&mutex);
+    while (queue.size() >= capacity)
+    {
+        if (_policy == DropNewest)
+        {
+            dropped++;
+            return;
+        }
+        else if (_policy == DropOldest)
+        {
+            queue.pop_front();
+            dropped++;
+        }
+        else                    // Block
+        {
+            notFull.wait(&mutex);
+        }
+    }
+
+    queue.push_back(pack);
+    maxDepth = std::max(maxDepth, (unsigned) queue.size());
+    notEmpty.wakeOne();
+}
+
+void AsyncSink::setNumChannels(unsigned nc, bool x)
+{
+    // queued packs have the old number of channels
+    flush();
+    Sink::setNumChannels(nc, x);
+}
+
+void AsyncSink::run()
+{
+    std::deque<QueuedPack> batch;
+
+    QMutexLocker locker(&mutex);
+    while (true)
+    {
+        while (queue.empty() && !quit)
+        {
+            if (!idleHandler || !idleInterval)
+            {
+                notEmpty.wait(&mutex);
+            }
+            // handler may be removed while waiting, even if the wake up is missed
+            else if (!notEmpty.wait(&mutex, idleInterval) && queue.empty() && !quit &&
+                     idleHandler)
+            {
+                // handler isn't changed while `idleRunning` is set
+                idleRunning = true;
+                locker.unlock();
+                idleHandler();
+                locker.relock();
+                idleRunning = false;
+                drained.wakeAll();
+            }
+        }
+        if (queue.empty()) break; // quit requested and everything is delivered
+
+        // take all queued packs, producer continues with an empty queue
+        batch.swap(queue);
+        inFlight = batch.size();
+        notFull.wakeAll();
+
+        locker.unlock();
+        for (auto& queued : batch)
+        {
+            _packTime = queued.time;
+            Sink::feedIn(*queued.pack);
+            inFlight--;
+        }
+        batch.clear();
+        locker.relock();
+
+        if (queue.empty()) drained.wakeAll();
+    }
+}
@@ -0,0 +1,130 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef ASYNCSINK_H
+#define ASYNCSINK_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QSharedPointer>
+#include <QThread>
+#include <QtGlobal>
+
+#include "sink.h"
+
+/**
+ * Feeds its followers on a worker thread so that a slow sink doesn't
+ * delay others connected to the same source.
+ *
+ * Incoming packs are copied once and queued as shared, immutable
+ * packs. Queue is double buffered: worker takes all queued packs at
+ * once and delivers them without holding the lock, while the producer
+ * fills the queue again. When the queue is full, the producer is
+ * either blocked until there is space (`Block`) or a pack is dropped.
+ *
+ * Number of channels changes are applied after queued packs are
+ * delivered. Followers are called from the worker thread, they should
+ * be connected before the `AsyncSink` is connected to a source and
+ * they shouldn't touch the GUI.
+ */
+class AsyncSink : public Sink
+{
+public:
+    enum Policy
+    {
+        Block = 0,              ///< wait for space, no data is lost
+        DropNewest,             ///< drop incoming pack
+        DropOldest              ///< drop oldest queued pack
+    };
+
+    explicit AsyncSink(unsigned capacity = 64, Policy policy = Block);
+    /// Delivers remaining packs before returning
+    ~AsyncSink();
+
+    void setPolicy(Policy policy);
+    Policy policy() const;
+
+    /// Waits until all queued packs are delivered
+    void flush();
+
+    /**
+     * Sets a function that is called from the worker thread when no
+     * pack is received for `intervalMs`. It's called repeatedly at
+     * this interval while idle. Returns after a running handler
+     * finishes, so handler isn't called after it's removed. Pass an
+     * empty function to remove.
+     */
+    void setIdleHandler(unsigned intervalMs, std::function<void()> handler);
+
+    /**
+     * Time the pack that is being delivered was queued, ms since
+     * epoch. Should only be called from `feedIn` of a follower, so
+     * that followers can timestamp data by its arrival rather than
+     * by its delivery.
+     */
+    qint64 packTime() const;
+
+    /// Number of packs waiting to be delivered, including the ones
+    /// taken by the worker
+    unsigned queueDepth() const;
+    /// Highest queue depth since last `resetStats()`
+    unsigned maxQueueDepth() const;
+    /// Number of dropped packs since last `resetStats()`
+    quint64 numDropped() const;
+    void resetStats();
+
+protected:
+    virtual void feedIn(const SamplePack& data);
+    virtual void setNumChannels(unsigned nc, bool x);
+
+private:
+    mutable QMutex mutex;
+    QWaitCondition notEmpty;
+    QWaitCondition notFull;
+    QWaitCondition drained;
+    struct QueuedPack
+    {
+        QSharedPointer<const SamplePack> pack;
+        qint64 time;            ///< queue time, ms since epoch
+    };
+
+    std::deque<QueuedPack> queue;
+    const unsigned capacity;
+    Policy _policy;
+    /// Number of packs taken by the worker but not delivered yet
+    std::atomic<unsigned> inFlight;
+    /// Queue time of the pack being delivered, only used by worker
+    qint64 _packTime;
+    bool quit;
+    unsigned idleInterval;
+    std::function<void()> idleHandler;
+    bool idleRunning;           ///< idle handler is being called
+    unsigned maxDepth;
+    quint64 dropped;
+    QThread* thread;
+
+    /// Worker thread loop
+    void run();
+};
+
+#endif // ASYNCSINK_H
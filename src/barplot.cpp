@@ -24,12 +24,14 @@ BarPlot::BarPlot(Stream* stream, PlotMenu* menu, QWidget* parent) :
     QwtPlot(parent), _menu(menu), barChart(stream)
 {
     _stream = stream;
+    _scheduler = nullptr;
+    updatePending = false;
     barChart.attach(this);
     setAxisMaxMinor(QwtPlot::xBottom, 0);
     setAxisScaleDraw(QwtPlot::xBottom, new BarScaleDraw(stream));
 
     update();
-    connect(_stream, &Stream::dataAdded, this, &BarPlot::update);
+    connect(_stream, &Stream::dataAdded, this, &BarPlot::onDataAdded);
     connect(_stream, &Stream::numChannelsChanged, this, &BarPlot::update);
 
     // connect to menu
@@ -44,6 +46,41 @@ void BarPlot::update()
     setAxisScale(QwtPlot::xBottom, 0, _stream->numChannels()-0.99, 1);
     barChart.resample();
     replot();
+    updatePending = false;
+}
+
+void BarPlot::setReplotScheduler(ReplotScheduler* scheduler)
+{
+    if (_scheduler != nullptr)
+    {
+        disconnect(_scheduler, nullptr, this, nullptr);
+    }
+    _scheduler = scheduler;
+
+    if (_scheduler != nullptr)
+    {
+        connect(_scheduler, &ReplotScheduler::frame, this, &BarPlot::onFrame);
+    }
+
+    if (updatePending) update();
+}
+
+void BarPlot::onDataAdded()
+{
+    if (_scheduler == nullptr)
+    {
+        update();
+    }
+    else
+    {
+        updatePending = true;
+        _scheduler->schedule();
+    }
+}
+
+void BarPlot::onFrame()
+{
+    if (updatePending) update();
 }
 
 void BarPlot::setYAxis(bool autoScaled, double yMin, double yMax)
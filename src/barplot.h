@@ -25,6 +25,7 @@
 #include "stream.h"
 #include "plotmenu.h"
 #include "barchart.h"
+#include "replotscheduler.h"
 
 class BarPlot : public QwtPlot
 {
@@ -40,16 +41,22 @@ public slots:
     void setYAxis(bool autoScaled, double yMin = 0, double yMax = 1);
     /// Enable/disable dark background
     void darkBackground(bool enabled);
+    /// Update at the frame rate of `scheduler`, `nullptr` to update for each data
+    void setReplotScheduler(ReplotScheduler* scheduler);
 
 private:
     Stream* _stream;
     PlotMenu* _menu;
     BarChart barChart;
+    ReplotScheduler* _scheduler;
+    bool updatePending;
 
     QVector<double> chartData() const;
 
 private slots:
     void update();
+    void onDataAdded();
+    void onFrame();
 };
 
 #endif // BARPLOT_H
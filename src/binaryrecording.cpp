@@ -0,0 +1,502 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <QDateTime>
+#include <QObject>
+#include <QtDebug>
+#include <QtEndian>
+
+#include "binaryrecording.h"
+
+static const char HEADER_MAGIC[] = "SPBINREC";
+static const char INDEX_MAGIC[] = "SPRECIDX";
+static const int MAGIC_SIZE = 8;
+static const quint32 VERSION = 1;
+/// Size of fixed part of the header
+static const unsigned HEADER_SIZE = 40;
+static const unsigned CHUNK_HEADER_SIZE = 16;
+static const unsigned INDEX_ENTRY_SIZE = 16;
+static const unsigned INDEX_TRAILER_SIZE = 24;
+
+static quint64 align8(quint64 n)
+{
+    return (n + 7) & ~quint64(7);
+}
+
+static void appendLE32(QByteArray& ba, quint32 v)
+{
+    char buf[4];
+    qToLittleEndian(v, buf);
+    ba.append(buf, 4);
+}
+
+static void appendLE64(QByteArray& ba, quint64 v)
+{
+    char buf[8];
+    qToLittleEndian(v, buf);
+    ba.append(buf, 8);
+}
+
+static void pad8(QByteArray& ba)
+{
+    ba.append(int(align8(ba.size()) - ba.size()), '\0');
+}
+
+bool BinaryRecording::isBinaryRecording(QIODevice* device)
+{
+    return device->peek(MAGIC_SIZE) == QByteArray(HEADER_MAGIC, MAGIC_SIZE);
+}
+
+BinaryRecordingWriter::BinaryRecordingWriter()
+{
+    _device = nullptr;
+    sampleType = BinaryRecording::SampleType::Float64;
+    sampleBytes = 8;
+    _numColumns = 0;
+    chunkSize = 0;
+    fill = 0;
+    chunkTime = 0;
+    offset = 0;
+    numSamples = 0;
+}
+
+bool BinaryRecordingWriter::start(QIODevice* device, QStringList names,
+                                  BinaryRecording::SampleType type)
+{
+    Q_ASSERT(device->isWritable());
+
+    if (names.isEmpty()) return false;
+
+    _device = device;
+    sampleType = type;
+    sampleBytes = type == BinaryRecording::SampleType::Float32 ? 4 : 8;
+    _numColumns = names.size();
+    chunkSize = std::max(1u, CHUNK_BYTES / (_numColumns * sampleBytes));
+    fill = 0;
+    offset = 0;
+    numSamples = 0;
+    index.clear();
+    // +8 for padding
+    chunk.resize(CHUNK_HEADER_SIZE + _numColumns * chunkSize * sampleBytes + 8);
+
+    QByteArray header(HEADER_MAGIC, MAGIC_SIZE);
+    appendLE32(header, VERSION);
+    appendLE32(header, 0);      // header size, set below
+    appendLE32(header, _numColumns);
+    appendLE32(header, quint32(sampleType));
+    appendLE32(header, chunkSize);
+    appendLE32(header, 0);
+    appendLE64(header, QDateTime::currentMSecsSinceEpoch());
+    for (auto& name : names)
+    {
+        QByteArray utf8 = name.toUtf8();
+        appendLE32(header, utf8.size());
+        header.append(utf8);
+    }
+    pad8(header);
+    qToLittleEndian(quint32(header.size()), header.data() + 12);
+
+    write(header.constData(), header.size());
+    return offset == quint64(header.size());
+}
+
+unsigned BinaryRecordingWriter::numColumns() const
+{
+    return _numColumns;
+}
+
+void BinaryRecordingWriter::addSamples(const double* const* columns, unsigned n)
+{
+    Q_ASSERT(_device != nullptr);
+
+    char* const data = chunk.data() + CHUNK_HEADER_SIZE;
+    unsigned i = 0;
+    while (i < n)
+    {
+        if (fill == 0) chunkTime = QDateTime::currentMSecsSinceEpoch();
+
+        unsigned k = std::min(n - i, chunkSize - fill);
+        for (unsigned c = 0; c < _numColumns; c++)
+        {
+            const double* src = columns[c] + i;
+            char* dst = data + (size_t(c) * chunkSize + fill) * sampleBytes;
+            if (sampleType == BinaryRecording::SampleType::Float32)
+            {
+                for (unsigned j = 0; j < k; j++)
+                {
+                    float f = src[j];
+                    quint32 u;
+                    memcpy(&u, &f, 4);
+                    qToLittleEndian(u, dst + j * 4);
+                }
+            }
+            else
+            {
+                for (unsigned j = 0; j < k; j++)
+                {
+                    quint64 u;
+                    memcpy(&u, &src[j], 8);
+                    qToLittleEndian(u, dst + j * 8);
+                }
+            }
+        }
+
+        fill += k;
+        i += k;
+        if (fill == chunkSize) writeChunk();
+    }
+}
+
+void BinaryRecordingWriter::flush(bool force)
+{
+    if (force || quint64(fill) * _numColumns * sampleBytes >= MIN_FLUSH_BYTES)
+    {
+        writeChunk();
+    }
+}
+
+void BinaryRecordingWriter::finish()
+{
+    if (_device == nullptr) return;
+
+    writeChunk();
+
+    QByteArray idx;
+    for (auto& entry : index)
+    {
+        appendLE64(idx, entry.offset);
+        appendLE64(idx, entry.firstSample);
+    }
+    appendLE64(idx, offset);
+    appendLE64(idx, index.size());
+    idx.append(INDEX_MAGIC, MAGIC_SIZE);
+    write(idx.constData(), idx.size());
+
+    _device = nullptr;
+}
+
+void BinaryRecordingWriter::writeChunk()
+{
+    if (fill == 0) return;
+
+    char* base = chunk.data();
+    qToLittleEndian(quint32(fill), base);
+    qToLittleEndian(quint32(0), base + 4);
+    qToLittleEndian(quint64(chunkTime), base + 8);
+
+    // make a partial chunk contiguous
+    char* data = base + CHUNK_HEADER_SIZE;
+    const size_t columnBytes = size_t(fill) * sampleBytes;
+    if (fill < chunkSize)
+    {
+        for (unsigned c = 1; c < _numColumns; c++)
+        {
+            memmove(data + c * columnBytes,
+                    data + size_t(c) * chunkSize * sampleBytes,
+                    columnBytes);
+        }
+    }
+
+    size_t size = CHUNK_HEADER_SIZE + _numColumns * columnBytes;
+    size_t padded = align8(size);
+    memset(base + size, 0, padded - size);
+
+    index.push_back({offset, numSamples});
+    write(base, padded);
+    numSamples += fill;
+    fill = 0;
+}
+
+void BinaryRecordingWriter::write(const char* data, qint64 size)
+{
+    qint64 r = _device->write(data, size);
+    if (r != size)
+    {
+        qCritical() << "Writing recording failed:" << _device->errorString();
+    }
+    if (r > 0) offset += r;
+}
+
+BinaryRecordingReader::BinaryRecordingReader()
+{
+    map = nullptr;
+    mapSize = 0;
+    _sampleType = BinaryRecording::SampleType::Float64;
+    sampleBytes = 8;
+    _startTime = 0;
+    _numSamples = 0;
+    indexRecovered = false;
+}
+
+BinaryRecordingReader::~BinaryRecordingReader()
+{
+    if (map != nullptr) file.unmap(const_cast<uchar*>(map));
+}
+
+bool BinaryRecordingReader::fail(QString error)
+{
+    _errorString = error;
+    return false;
+}
+
+bool BinaryRecordingReader::open(QString fileName)
+{
+    if (map != nullptr) file.unmap(const_cast<uchar*>(map));
+    map = nullptr;
+    file.close();
+    names.clear();
+    chunks.clear();
+    _numSamples = 0;
+    indexRecovered = false;
+
+    file.setFileName(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return fail(file.errorString());
+    }
+
+    mapSize = file.size();
+    if (mapSize < HEADER_SIZE)
+    {
+        return fail(QObject::tr("File is too small"));
+    }
+
+    map = file.map(0, mapSize);
+    if (map == nullptr)
+    {
+        return fail(file.errorString());
+    }
+
+    quint64 headerSize;
+    if (!readHeader(headerSize)) return false;
+
+    if (!readIndex())
+    {
+        qWarning() << "Recording index is missing or invalid, scanning chunks:" << fileName;
+        if (!walkChunks(headerSize)) return false;
+    }
+
+    return true;
+}
+
+bool BinaryRecordingReader::readHeader(quint64& headerSize)
+{
+    if (memcmp(map, HEADER_MAGIC, MAGIC_SIZE))
+    {
+        return fail(QObject::tr("Not a binary recording"));
+    }
+
+    quint32 version = qFromLittleEndian<quint32>(map + 8);
+    if (version != VERSION)
+    {
+        return fail(QObject::tr("Unsupported recording version: %1").arg(version));
+    }
+
+    headerSize = qFromLittleEndian<quint32>(map + 12);
+    unsigned numChannels = qFromLittleEndian<quint32>(map + 16);
+    quint32 type = qFromLittleEndian<quint32>(map + 20);
+    _startTime = qFromLittleEndian<qint64>(map + 32);
+
+    if (type > quint32(BinaryRecording::SampleType::Float64))
+    {
+        return fail(QObject::tr("Unknown sample type: %1").arg(type));
+    }
+    _sampleType = BinaryRecording::SampleType(type);
+    sampleBytes = _sampleType == BinaryRecording::SampleType::Float32 ? 4 : 8;
+
+    if (headerSize > mapSize || !numChannels)
+    {
+        return fail(QObject::tr("Invalid header"));
+    }
+
+    quint64 pos = HEADER_SIZE;
+    for (unsigned ci = 0; ci < numChannels; ci++)
+    {
+        if (pos + 4 > headerSize) return fail(QObject::tr("Invalid header"));
+        quint32 len = qFromLittleEndian<quint32>(map + pos);
+        pos += 4;
+        if (pos + len > headerSize) return fail(QObject::tr("Invalid header"));
+        names << QString::fromUtf8(reinterpret_cast<const char*>(map + pos), len);
+        pos += len;
+    }
+
+    return true;
+}
+
+bool BinaryRecordingReader::readIndex()
+{
+    if (mapSize < HEADER_SIZE + INDEX_TRAILER_SIZE ||
+        memcmp(map + mapSize - MAGIC_SIZE, INDEX_MAGIC, MAGIC_SIZE))
+    {
+        return false;
+    }
+
+    const quint64 indexOffset = qFromLittleEndian<quint64>(map + mapSize - INDEX_TRAILER_SIZE);
+    const quint64 count = qFromLittleEndian<quint64>(map + mapSize - INDEX_TRAILER_SIZE + 8);
+    if (indexOffset > mapSize ||
+        (mapSize - indexOffset - INDEX_TRAILER_SIZE) != count * INDEX_ENTRY_SIZE)
+    {
+        return false;
+    }
+
+    const quint64 chunkSampleBytes = quint64(names.size()) * sampleBytes;
+    for (quint64 i = 0; i < count; i++)
+    {
+        const uchar* entry = map + indexOffset + i * INDEX_ENTRY_SIZE;
+        Chunk c;
+        c.offset = qFromLittleEndian<quint64>(entry);
+        c.firstSample = qFromLittleEndian<quint64>(entry + 8);
+        if (c.offset + CHUNK_HEADER_SIZE > indexOffset ||
+            c.firstSample != _numSamples)
+        {
+            chunks.clear();
+            _numSamples = 0;
+            return false;
+        }
+        c.numSamples = qFromLittleEndian<quint32>(map + c.offset);
+        if (c.offset + CHUNK_HEADER_SIZE + c.numSamples * chunkSampleBytes > indexOffset)
+        {
+            chunks.clear();
+            _numSamples = 0;
+            return false;
+        }
+        chunks.push_back(c);
+        _numSamples += c.numSamples;
+    }
+
+    return true;
+}
+
+bool BinaryRecordingReader::walkChunks(quint64 headerSize)
+{
+    const quint64 chunkSampleBytes = quint64(names.size()) * sampleBytes;
+    quint64 pos = align8(headerSize);
+    while (pos + CHUNK_HEADER_SIZE <= mapSize)
+    {
+        unsigned ns = qFromLittleEndian<quint32>(map + pos);
+        quint64 size = CHUNK_HEADER_SIZE + ns * chunkSampleBytes;
+        // stop at the index, an empty or a truncated chunk
+        if (!ns || pos + size > mapSize) break;
+
+        chunks.push_back({pos, _numSamples, ns});
+        _numSamples += ns;
+        pos += align8(size);
+    }
+
+    indexRecovered = true;
+    return true;
+}
+
+QString BinaryRecordingReader::errorString() const
+{
+    return _errorString;
+}
+
+unsigned BinaryRecordingReader::numChannels() const
+{
+    return names.size();
+}
+
+QStringList BinaryRecordingReader::channelNames() const
+{
+    return names;
+}
+
+BinaryRecording::SampleType BinaryRecordingReader::sampleType() const
+{
+    return _sampleType;
+}
+
+qint64 BinaryRecordingReader::startTime() const
+{
+    return _startTime;
+}
+
+quint64 BinaryRecordingReader::numSamples() const
+{
+    return _numSamples;
+}
+
+unsigned BinaryRecordingReader::numChunks() const
+{
+    return chunks.size();
+}
+
+qint64 BinaryRecordingReader::chunkTime(unsigned chunk) const
+{
+    Q_ASSERT(chunk < chunks.size());
+    return qFromLittleEndian<qint64>(map + chunks[chunk].offset + 8);
+}
+
+bool BinaryRecordingReader::isIndexRecovered() const
+{
+    return indexRecovered;
+}
+
+unsigned BinaryRecordingReader::findChunk(quint64 sample) const
+{
+    auto it = std::upper_bound(chunks.begin(), chunks.end(), sample,
+                               [](quint64 s, const Chunk& c)
+                               {
+                                   return s < c.firstSample;
+                               });
+    return std::distance(chunks.begin(), it) - 1;
+}
+
+void BinaryRecordingReader::readChannel(unsigned channel, quint64 start,
+                                        quint64 n, double* out) const
+{
+    Q_ASSERT(channel < numChannels());
+    Q_ASSERT(start + n <= _numSamples);
+
+    while (n)
+    {
+        const Chunk& c = chunks[findChunk(start)];
+        const quint64 local = start - c.firstSample;
+        const quint64 k = std::min(n, c.numSamples - local);
+        const uchar* src = map + c.offset + CHUNK_HEADER_SIZE +
+            (quint64(channel) * c.numSamples + local) * sampleBytes;
+
+        if (_sampleType == BinaryRecording::SampleType::Float32)
+        {
+            for (quint64 j = 0; j < k; j++)
+            {
+                quint32 u = qFromLittleEndian<quint32>(src + j * 4);
+                float f;
+                memcpy(&f, &u, 4);
+                out[j] = f;
+            }
+        }
+        else
+        {
+            for (quint64 j = 0; j < k; j++)
+            {
+                quint64 u = qFromLittleEndian<quint64>(src + j * 8);
+                memcpy(&out[j], &u, 8);
+            }
+        }
+
+        out += k;
+        start += k;
+        n -= k;
+    }
+}
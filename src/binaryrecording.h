@@ -0,0 +1,213 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BINARYRECORDING_H
+#define BINARYRECORDING_H
+
+#include <vector>
+#include <QByteArray>
+#include <QFile>
+#include <QIODevice>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+
+/**
+ * @file
+ *
+ * Binary recording format. All numbers are little endian and every
+ * section starts at a multiple of 8 bytes so that a memory mapped
+ * file can be accessed directly.
+ *
+ * Header:
+ *
+ *     char[8]  magic "SPBINREC"
+ *     u32      version
+ *     u32      header size, including magic and padding
+ *     u32      number of channels (columns)
+ *     u32      sample type (0: float32, 1: float64)
+ *     u32      chunk size, number of samples per channel in a full chunk
+ *     u32      reserved
+ *     i64      start time, ms since epoch
+ *     for each channel:
+ *         u32  length of name, in bytes
+ *         u8[] UTF-8 name
+ *     padding
+ *
+ * Chunks, one after the other:
+ *
+ *     u32      number of samples per channel (n)
+ *     u32      reserved
+ *     i64      time of the first sample, ms since epoch
+ *     samples, column major: n samples of channel 0, then channel 1...
+ *     padding
+ *
+ * Index, written when recording is stopped:
+ *
+ *     for each chunk:
+ *         u64  file offset of chunk
+ *         u64  number of samples (per channel) before this chunk
+ *     u64      file offset of index
+ *     u64      number of chunks
+ *     char[8]  magic "SPRECIDX"
+ *
+ * If the index is missing (recording wasn't stopped properly) chunks
+ * can still be found by walking the chunk headers.
+ */
+
+namespace BinaryRecording
+{
+    enum class SampleType : quint32
+    {
+        Float32 = 0,
+        Float64 = 1
+    };
+
+    /// Returns true if device contains a binary recording, device
+    /// position isn't changed
+    bool isBinaryRecording(QIODevice* device);
+}
+
+/// Writes a binary recording into a device
+class BinaryRecordingWriter
+{
+public:
+    BinaryRecordingWriter();
+
+    /**
+     * Writes the header. Device should be open for writing.
+     *
+     * @param device output, must stay open until `finish()`
+     * @param names names of columns, determines the number of columns
+     * @return false if write fails
+     */
+    bool start(QIODevice* device, QStringList names,
+               BinaryRecording::SampleType type);
+    /// Number of columns of the current recording
+    unsigned numColumns() const;
+    /**
+     * Adds samples. Chunks are written as they are filled.
+     *
+     * @param columns pointers to data of each column, `numColumns()` of them
+     * @param numSamples number of samples in each column
+     */
+    void addSamples(const double* const* columns, unsigned numSamples);
+    /**
+     * Writes the partially filled chunk, if any. Unless `force` is
+     * set, chunk is kept until it has at least `MIN_FLUSH_BYTES` of
+     * samples so that frequent flushes don't produce tiny chunks.
+     */
+    void flush(bool force = false);
+    /// Writes remaining samples and the index
+    void finish();
+
+private:
+    /// Target size of a chunk data (bytes)
+    static const unsigned CHUNK_BYTES = 1024 * 1024;
+    /// Minimum chunk data size (bytes) written by a non-forced `flush()`
+    static const unsigned MIN_FLUSH_BYTES = 64 * 1024;
+
+    struct IndexEntry
+    {
+        quint64 offset;
+        quint64 firstSample;
+    };
+
+    QIODevice* _device;
+    BinaryRecording::SampleType sampleType;
+    unsigned sampleBytes;
+    unsigned _numColumns;
+    unsigned chunkSize;         ///< samples per column in a full chunk
+    unsigned fill;              ///< samples per column in current chunk
+    qint64 chunkTime;           ///< time of first sample of current chunk
+    QByteArray chunk;           ///< current chunk including its header
+    quint64 offset;             ///< number of bytes written so far
+    quint64 numSamples;         ///< number of samples written per column
+    std::vector<IndexEntry> index;
+
+    /// Writes data and updates `offset`
+    void write(const char* data, qint64 size);
+    /// Writes current chunk, even if it isn't full
+    void writeChunk();
+};
+
+/// Reads a binary recording through a memory mapping of the file
+class BinaryRecordingReader
+{
+public:
+    BinaryRecordingReader();
+    ~BinaryRecordingReader();
+
+    /// Opens and maps the file, reads header and index
+    bool open(QString fileName);
+    QString errorString() const;
+
+    unsigned numChannels() const;
+    QStringList channelNames() const;
+    BinaryRecording::SampleType sampleType() const;
+    /// Start time of recording, ms since epoch
+    qint64 startTime() const;
+    /// Number of samples per channel
+    quint64 numSamples() const;
+    /// Number of chunks
+    unsigned numChunks() const;
+    /// Time of the first sample of a chunk, ms since epoch
+    qint64 chunkTime(unsigned chunk) const;
+    /// Returns true if index was missing and chunks are found by walking
+    bool isIndexRecovered() const;
+
+    /**
+     * Reads samples of a channel.
+     *
+     * @param channel channel index
+     * @param start index of first sample
+     * @param n number of samples, `start + n` must be <= `numSamples()`
+     * @param out output, must have room for `n` samples
+     */
+    void readChannel(unsigned channel, quint64 start, quint64 n, double* out) const;
+
+private:
+    struct Chunk
+    {
+        quint64 offset;
+        quint64 firstSample;
+        unsigned numSamples;
+    };
+
+    QFile file;
+    const uchar* map;
+    quint64 mapSize;
+    QString _errorString;
+    QStringList names;
+    BinaryRecording::SampleType _sampleType;
+    unsigned sampleBytes;
+    qint64 _startTime;
+    quint64 _numSamples;
+    bool indexRecovered;
+    std::vector<Chunk> chunks;
+
+    bool fail(QString error);
+    bool readHeader(quint64& headerSize);
+    bool readIndex();
+    bool walkChunks(quint64 headerSize);
+    /// Returns the chunk that contains `sample`
+    unsigned findChunk(quint64 sample) const;
+};
+
+#endif // BINARYRECORDING_H
@@ -0,0 +1,95 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "bytering.h"
+
+ByteRing::ByteRing(unsigned capacity) :
+    data(std::max(1u, capacity)), _marks(std::max(1u, capacity))
+{
+    _begin = 0;
+    _end = 0;
+}
+
+unsigned ByteRing::capacity() const
+{
+    return data.size();
+}
+
+quint64 ByteRing::begin() const
+{
+    return _begin;
+}
+
+quint64 ByteRing::end() const
+{
+    return _end;
+}
+
+void ByteRing::append(const char* in, unsigned n)
+{
+    const unsigned cap = capacity();
+
+    // only the last `capacity` bytes can be stored
+    if (n > cap)
+    {
+        _end += n - cap;
+        in += n - cap;
+        n = cap;
+    }
+
+    // copy in at most 2 parts
+    unsigned pos = _end % cap;
+    unsigned part = std::min(n, cap - pos);
+    memcpy(&data[pos], in, part);
+    memset(&_marks[pos], 0, part);
+    if (part < n)
+    {
+        memcpy(&data[0], in + part, n - part);
+        memset(&_marks[0], 0, n - part);
+    }
+
+    _end += n;
+    _begin = std::max(_begin, _end > cap ? _end - cap : 0);
+}
+
+quint8 ByteRing::byte(quint64 pos) const
+{
+    Q_ASSERT(pos >= _begin && pos < _end);
+    return data[pos % capacity()];
+}
+
+quint8 ByteRing::marks(quint64 pos) const
+{
+    Q_ASSERT(pos >= _begin && pos < _end);
+    return _marks[pos % capacity()];
+}
+
+void ByteRing::mark(quint64 pos, quint8 flags)
+{
+    if (pos < _begin || pos >= _end) return;
+    _marks[pos % capacity()] |= flags;
+}
+
+void ByteRing::clear()
+{
+    _begin = _end;
+}
@@ -0,0 +1,69 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BYTERING_H
+#define BYTERING_H
+
+#include <vector>
+#include <QtGlobal>
+
+/**
+ * Fixed size ring buffer of raw bytes with per byte marks.
+ *
+ * Bytes are addressed by their absolute position in the stream,
+ * starting from 0 with the first byte ever appended. Only the last
+ * `capacity()` bytes are kept, in range [`begin()`, `end()`).
+ */
+class ByteRing
+{
+public:
+    /// Marks that can be set for a byte, can be combined
+    enum Mark : quint8
+    {
+        SyncByte = 0x01,   ///< part of a sync word
+        FrameStart = 0x02, ///< first byte of a frame
+        Error = 0x04       ///< an error is detected at this byte
+    };
+
+    explicit ByteRing(unsigned capacity);
+
+    unsigned capacity() const;
+    /// Position of the oldest stored byte
+    quint64 begin() const;
+    /// Position after the newest stored byte
+    quint64 end() const;
+    /// Appends bytes, new bytes have no marks
+    void append(const char* data, unsigned n);
+    /// Returns the byte at `pos`, must be in range
+    quint8 byte(quint64 pos) const;
+    /// Returns the marks of byte at `pos`, must be in range
+    quint8 marks(quint64 pos) const;
+    /// Adds `flags` to the byte at `pos`, ignored if out of range
+    void mark(quint64 pos, quint8 flags);
+    /// Drops all bytes. Positions continue from `end()`.
+    void clear();
+
+private:
+    std::vector<quint8> data;
+    std::vector<quint8> _marks;
+    quint64 _begin;
+    quint64 _end;
+};
+
+#endif // BYTERING_H
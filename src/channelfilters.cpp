@@ -0,0 +1,223 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "channelfilters.h"
+
+ChannelFilters::ChannelFilters()
+{
+    _numChannels = 0;
+    _hasX = false;
+    _decimation = 1;
+    decPhase = 0;
+    anyActive = false;
+    bufSamples = 0;
+}
+
+ChannelFilters::~ChannelFilters()
+{
+    for (auto f : filters)
+    {
+        delete f;
+    }
+}
+
+unsigned ChannelFilters::numChannels() const
+{
+    return _numChannels;
+}
+
+bool ChannelFilters::hasX() const
+{
+    return _hasX;
+}
+
+void ChannelFilters::setFilter(unsigned channel, const FilterSpec& spec)
+{
+    while ((unsigned) specs.size() <= channel)
+    {
+        specs.append(FilterSpec());
+    }
+    specs[channel] = spec;
+
+    if (channel < _numChannels)
+    {
+        updateFilter(channel);
+    }
+}
+
+FilterSpec ChannelFilters::filter(unsigned channel) const
+{
+    if (channel < (unsigned) specs.size())
+    {
+        return specs[channel];
+    }
+    return FilterSpec();
+}
+
+unsigned ChannelFilters::numActive() const
+{
+    unsigned r = 0;
+    for (auto f : filters)
+    {
+        if (f != nullptr) r++;
+    }
+    return r;
+}
+
+void ChannelFilters::updateFilter(unsigned channel)
+{
+    Q_ASSERT(channel < (unsigned) filters.size());
+
+    delete filters[channel];
+    filters[channel] = Filter::create(filter(channel));
+    anyActive = numActive() > 0;
+}
+
+void ChannelFilters::reserve(unsigned ns)
+{
+    bufSamples = std::max(bufSamples, ns);
+    size_t size = size_t(bufSamples) * _numChannels;
+    if (yBuffer.size() < size) yBuffer.resize(size);
+    if (_hasX && xBuffer.size() < bufSamples) xBuffer.resize(bufSamples);
+}
+
+void ChannelFilters::setDecimation(unsigned factor)
+{
+    Q_ASSERT(factor > 0);
+    _decimation = factor;
+    decPhase = 0;
+}
+
+unsigned ChannelFilters::decimation() const
+{
+    return _decimation;
+}
+
+void ChannelFilters::reset()
+{
+    for (auto f : filters)
+    {
+        if (f != nullptr) f->reset();
+    }
+    decPhase = 0;
+}
+
+void ChannelFilters::setNumChannels(unsigned nc, bool x)
+{
+    unsigned oldNum = _numChannels;
+    _hasX = x;
+
+    for (unsigned ci = nc; ci < oldNum; ci++)
+    {
+        delete filters[ci];
+    }
+    filters.resize(nc);
+    _numChannels = nc;
+    for (unsigned ci = oldNum; ci < nc; ci++)
+    {
+        filters[ci] = nullptr;
+        updateFilter(ci);
+    }
+
+    anyActive = numActive() > 0;
+
+    Sink::setNumChannels(nc, x);
+    updateNumChannels();
+
+    if (nc != oldNum)
+    {
+        emit numChannelsChanged(nc);
+    }
+}
+
+void ChannelFilters::feedIn(const SamplePack& data)
+{
+    Q_ASSERT(data.numChannels() == _numChannels && data.hasX() == _hasX);
+
+    if (_decimation == 1 && !anyActive)
+    {
+        Sink::feedIn(data);
+        feedOut(data);
+        return;
+    }
+
+    unsigned ns = data.numSamples();
+    reserve(ns);
+    double* const xOut = _hasX ? xBuffer.data() : nullptr;
+    auto yOut = [this](unsigned ci) {return yBuffer.data() + size_t(ci) * bufSamples;};
+
+    // filtered data is written to the buffer, otherwise input is decimated directly
+    SamplePack filtered(ns, _numChannels, yBuffer.data(), bufSamples, xOut);
+    if (anyActive)
+    {
+        if (_hasX)
+        {
+            memcpy(xOut, data.xData(), ns * sizeof(double));
+        }
+        for (unsigned ci = 0; ci < _numChannels; ci++)
+        {
+            if (filters[ci] != nullptr)
+            {
+                filters[ci]->process(data.data(ci), yOut(ci), ns);
+            }
+            else
+            {
+                memcpy(yOut(ci), data.data(ci), ns * sizeof(double));
+            }
+        }
+    }
+    const SamplePack& in = anyActive ? filtered : data;
+
+    if (_decimation == 1)
+    {
+        Sink::feedIn(in);
+        feedOut(in);
+        return;
+    }
+
+    // pick every Nth sample, keeping the phase across packs
+    unsigned first = decPhase;
+    unsigned nOut = (first < ns) ? (ns - first - 1) / _decimation + 1 : 0;
+    decPhase = first + nOut * _decimation - ns;
+    if (nOut == 0) return;
+
+    // source index is never behind destination, so picking can be in place
+    auto pick = [this, first, nOut](const double* src, double* dst)
+        {
+            for (unsigned i = 0; i < nOut; i++)
+            {
+                dst[i] = src[first + i * _decimation];
+            }
+        };
+    if (_hasX)
+    {
+        pick(in.xData(), xOut);
+    }
+    for (unsigned ci = 0; ci < _numChannels; ci++)
+    {
+        pick(in.data(ci), yOut(ci));
+    }
+
+    SamplePack decimated(nOut, _numChannels, yBuffer.data(), bufSamples, xOut);
+    Sink::feedIn(decimated);
+    feedOut(decimated);
+}
@@ -0,0 +1,100 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CHANNELFILTERS_H
+#define CHANNELFILTERS_H
+
+#include <vector>
+#include <QObject>
+#include <QList>
+#include <QVector>
+
+#include "sink.h"
+#include "source.h"
+#include "filter.h"
+
+/**
+ * Filters channels with per channel filters and optionally decimates
+ * all channels.
+ *
+ * Sits in between a reader and the rest of the pipeline. Filter
+ * states are kept across `SamplePack`s. When no filter is set and
+ * decimation is 1 data is passed through without copying. Otherwise
+ * output is written to a buffer that is only grown when needed, so
+ * there are no allocations per pack.
+ */
+class ChannelFilters : public QObject, public Sink, public Source
+{
+    Q_OBJECT
+
+public:
+    ChannelFilters();
+    ~ChannelFilters();
+
+    /// Sets filter of a channel, previous state is dropped
+    void setFilter(unsigned channel, const FilterSpec& spec);
+    /// Returns the filter spec of a channel, `None` if not set
+    FilterSpec filter(unsigned channel) const;
+    /// Returns number of channels with an active filter
+    unsigned numActive() const;
+
+    /// Sets decimation factor, 1 disables decimation
+    void setDecimation(unsigned factor);
+    unsigned decimation() const;
+
+    /// Clears all filter states
+    void reset();
+
+    // implementations for `Source`
+    virtual unsigned numChannels() const;
+    virtual bool hasX() const;
+
+signals:
+    void numChannelsChanged(unsigned value);
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    unsigned _numChannels;
+    bool _hasX;
+    unsigned _decimation;
+    unsigned decPhase;          ///< samples to skip before next kept sample
+
+    /// Filter specs of channels, not removed when channels are removed
+    QList<FilterSpec> specs;
+    /// Filters of current channels, `nullptr` if not filtered
+    QVector<Filter*> filters;
+    /// At least one channel has a filter, cached `numActive() > 0`
+    bool anyActive;
+
+    /// Output buffer, channels are `bufSamples` apart
+    std::vector<double> yBuffer;
+    std::vector<double> xBuffer;
+    unsigned bufSamples;        ///< capacity of buffers per channel
+
+    /// (Re)creates filter of given channel
+    void updateFilter(unsigned channel);
+    /// Grows output buffers to fit `ns` samples of all channels
+    void reserve(unsigned ns);
+};
+
+#endif // CHANNELFILTERS_H
@@ -62,6 +62,7 @@ ChannelInfoModel::ChannelInfoModel(unsigned numberOfChannels, QObject* parent) :
     QAbstractTableModel(parent)
 {
     _numOfChannels = 0;
+    _statsEnabled = false;
     setNumOfChannels(numberOfChannels);
 }
 
@@ -170,7 +171,7 @@ int ChannelInfoModel::rowCount(const QModelIndex &parent) const
 
 int ChannelInfoModel::columnCount(const QModelIndex & parent) const
 {
-    return COLUMN_COUNT;
+    return _statsEnabled ? COLUMN_COUNT : COLUMN_MEAN;
 }
 
 Qt::ItemFlags ChannelInfoModel::flags(const QModelIndex &index) const
@@ -187,6 +188,10 @@ Qt::ItemFlags ChannelInfoModel::flags(const QModelIndex &index) const
     {
         return Qt::ItemIsEditable | Qt::ItemIsUserCheckable | Qt::ItemIsEnabled | Qt::ItemNeverHasChildren | Qt::ItemIsSelectable;
     }
+    else if (index.column() >= COLUMN_MEAN && index.column() < COLUMN_COUNT)
+    {
+        return Qt::ItemIsEnabled | Qt::ItemNeverHasChildren | Qt::ItemIsSelectable;
+    }
 
     return Qt::NoItemFlags;
 }
@@ -244,6 +249,45 @@ QVariant ChannelInfoModel::data(const QModelIndex &index, int role) const
         {
             return QVariant(info.offset);
         }
+    } // statistics
+    else if (index.column() >= COLUMN_MEAN && index.column() < COLUMN_COUNT)
+    {
+        if (role == Qt::DisplayRole)
+        {
+            return statValue(index.row(), index.column());
+        }
+        else if (role == Qt::TextAlignmentRole)
+        {
+            return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+        }
+    }
+
+    return QVariant();
+}
+
+QVariant ChannelInfoModel::statValue(unsigned channel, int column) const
+{
+    if (channel >= (unsigned) _stats.size()) return QVariant();
+
+    auto& st = _stats[channel];
+    if (st.count() == 0) return QVariant();
+
+    switch (column)
+    {
+        case COLUMN_MEAN:
+            return st.mean();
+        case COLUMN_RMS:
+            return st.rms();
+        case COLUMN_MIN:
+            return st.min();
+        case COLUMN_MAX:
+            return st.max();
+        case COLUMN_STDDEV:
+            return st.stdDev();
+        case COLUMN_PEAKTOPEAK:
+            return st.peakToPeak();
+        case COLUMN_SAMPLES:
+            return QVariant((qulonglong) st.count());
     }
 
     return QVariant();
@@ -271,6 +315,34 @@ QVariant ChannelInfoModel::headerData(int section, Qt::Orientation orientation,
             {
                 return tr("Offset");
             }
+            else if (section == COLUMN_MEAN)
+            {
+                return tr("Mean");
+            }
+            else if (section == COLUMN_RMS)
+            {
+                return tr("RMS");
+            }
+            else if (section == COLUMN_MIN)
+            {
+                return tr("Min");
+            }
+            else if (section == COLUMN_MAX)
+            {
+                return tr("Max");
+            }
+            else if (section == COLUMN_STDDEV)
+            {
+                return tr("Std Dev");
+            }
+            else if (section == COLUMN_PEAKTOPEAK)
+            {
+                return tr("Pk-Pk");
+            }
+            else if (section == COLUMN_SAMPLES)
+            {
+                return tr("Samples");
+            }
         }
     }
     else                        // vertical
@@ -408,6 +480,42 @@ void ChannelInfoModel::setNumOfChannels(unsigned number)
     }
 }
 
+void ChannelInfoModel::setStatsEnabled(bool enabled)
+{
+    if (enabled == _statsEnabled) return;
+
+    if (enabled)
+    {
+        beginInsertColumns(QModelIndex(), COLUMN_MEAN, COLUMN_COUNT-1);
+        _statsEnabled = true;
+        endInsertColumns();
+    }
+    else
+    {
+        beginRemoveColumns(QModelIndex(), COLUMN_MEAN, COLUMN_COUNT-1);
+        _statsEnabled = false;
+        _stats.clear();
+        endRemoveColumns();
+    }
+}
+
+bool ChannelInfoModel::statsEnabled() const
+{
+    return _statsEnabled;
+}
+
+void ChannelInfoModel::setStats(const QVector<RunningStats>& stats)
+{
+    if (!_statsEnabled) return;
+
+    _stats = stats;
+    if (_numOfChannels)
+    {
+        emit dataChanged(index(0, COLUMN_MEAN), index(_numOfChannels-1, COLUMN_COUNT-1),
+                         QVector<int>({Qt::DisplayRole}));
+    }
+}
+
 void ChannelInfoModel::resetInfos()
 {
     beginResetModel();
@@ -24,6 +24,9 @@
 #include <QColor>
 #include <QSettings>
 #include <QStringList>
+#include <QVector>
+
+#include "runningstats.h"
 
 class ChannelInfoModel : public QAbstractTableModel
 {
@@ -36,6 +39,14 @@ public:
         COLUMN_VISIBILITY,
         COLUMN_GAIN,
         COLUMN_OFFSET,
+        // statistics columns, only present when statistics are enabled
+        COLUMN_MEAN,            // MUST be first statistics column
+        COLUMN_RMS,
+        COLUMN_MIN,
+        COLUMN_MAX,
+        COLUMN_STDDEV,
+        COLUMN_PEAKTOPEAK,
+        COLUMN_SAMPLES,
         COLUMN_COUNT            // MUST be last
     };
 
@@ -64,6 +75,11 @@ public:
     QVariant      headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
 
     void setNumOfChannels(unsigned number);
+    /// Adds or removes statistics columns
+    void setStatsEnabled(bool enabled);
+    bool statsEnabled() const;
+    /// Sets displayed statistics of channels
+    void setStats(const QVector<RunningStats>& stats);
     /// Stores all channel info into a `QSettings`
     void saveSettings(QSettings* settings) const;
     /// Loads all channel info from a `QSettings`.
@@ -110,6 +126,12 @@ private:
      */
     bool _gainOrOffsetEn;
 
+    bool _statsEnabled;
+    QVector<RunningStats> _stats; ///< displayed statistics
+
+    /// Returns the value of a statistics column
+    QVariant statValue(unsigned channel, int column) const;
+
     /// Updates `_gainOrOffsetEn` by scanning all channel infos.
     void updateGainOrOffsetEn();
 };
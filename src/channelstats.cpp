@@ -0,0 +1,134 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+
+#include "channelstats.h"
+
+/// Period of statistics display updates in ms
+const int UPDATE_PERIOD = 200;
+
+ChannelStats::ChannelStats(Stream* stream, QObject* parent) :
+    QObject(parent)
+{
+    _stream = stream;
+    _mode = Off;
+
+    updateTimer.setInterval(UPDATE_PERIOD);
+    connect(&updateTimer, &QTimer::timeout, this, &ChannelStats::updateModel);
+    connect(_stream, &Stream::numSamplesChanged, this, [this](unsigned value)
+            {
+                for (auto& w : windows) w.setWindowSize(value);
+            });
+}
+
+ChannelStats::~ChannelStats()
+{
+    if (_mode != Off)
+    {
+        _stream->disconnectFollower(this);
+    }
+}
+
+ChannelStats::Mode ChannelStats::mode() const
+{
+    return _mode;
+}
+
+void ChannelStats::setMode(Mode mode)
+{
+    if (mode == _mode) return;
+
+    auto model = _stream->infoModel();
+    if (mode == Off)
+    {
+        _stream->disconnectFollower(this);
+        updateTimer.stop();
+        model->setStatsEnabled(false);
+    }
+    else if (_mode == Off)
+    {
+        // followers are given number of channels when connected
+        _stream->connectFollower(this);
+        updateTimer.start();
+        model->setStatsEnabled(true);
+    }
+
+    _mode = mode;
+    reset();
+}
+
+RunningStats ChannelStats::stats(unsigned channel) const
+{
+    Q_ASSERT(channel < (unsigned) cumulative.size());
+
+    if (_mode == Window)
+    {
+        return windows[channel].stats();
+    }
+    return cumulative[channel];
+}
+
+void ChannelStats::reset()
+{
+    for (auto& s : cumulative) s.clear();
+    for (auto& w : windows) w.clear();
+    if (_mode != Off) updateModel();
+}
+
+void ChannelStats::setNumChannels(unsigned nc, bool x)
+{
+    cumulative.resize(nc);
+    windows.resize(nc);
+    for (auto& w : windows)
+    {
+        w.setWindowSize(_stream->numSamples());
+    }
+    Sink::setNumChannels(nc, x);
+}
+
+void ChannelStats::feedIn(const SamplePack& data)
+{
+    unsigned ns = data.numSamples();
+    unsigned nc = std::min((unsigned) cumulative.size(), data.numChannels());
+    for (unsigned ci = 0; ci < nc; ci++)
+    {
+        if (_mode == Window)
+        {
+            windows[ci].addSamples(data.data(ci), ns);
+        }
+        else
+        {
+            cumulative[ci].addSamples(data.data(ci), ns);
+        }
+    }
+
+    Sink::feedIn(data);
+}
+
+void ChannelStats::updateModel()
+{
+    QVector<RunningStats> values;
+    for (unsigned ci = 0; ci < (unsigned) cumulative.size(); ci++)
+    {
+        values.append(stats(ci));
+    }
+    _stream->infoModel()->setStats(values);
+}
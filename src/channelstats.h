@@ -0,0 +1,81 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef CHANNELSTATS_H
+#define CHANNELSTATS_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+
+#include "sink.h"
+#include "stream.h"
+#include "runningstats.h"
+
+/**
+ * Calculates statistics of all channels of a `Stream` and displays
+ * them in its `ChannelInfoModel`.
+ *
+ * Connects itself to the stream as a follower only when enabled.
+ * Statistics are updated incrementally with each `SamplePack`, cost
+ * is proportional to the number of new samples. Model is updated
+ * periodically.
+ */
+class ChannelStats : public QObject, public Sink
+{
+    Q_OBJECT
+
+public:
+    enum Mode
+    {
+        Off = 0,
+        Cumulative,             ///< all samples since last reset
+        Window                  ///< last `Stream::numSamples()` samples
+    };
+
+    explicit ChannelStats(Stream* stream, QObject* parent = 0);
+    ~ChannelStats();
+
+    Mode mode() const;
+    /// Returns current statistics of a channel
+    RunningStats stats(unsigned channel) const;
+
+public slots:
+    void setMode(Mode mode);
+    /// Clears all statistics
+    void reset();
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    Stream* _stream;
+    Mode _mode;
+    QVector<RunningStats> cumulative;
+    QVector<WindowStats> windows;
+    QTimer updateTimer;
+
+    /// Pushes current statistics to the model
+    void updateModel();
+};
+
+#endif // CHANNELSTATS_H
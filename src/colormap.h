@@ -0,0 +1,53 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef COLORMAP_H
+#define COLORMAP_H
+
+#include <algorithm>
+#include <QColor>
+#include <QRgb>
+
+/// Number of entries of a color table filled by `fillColorTable()`
+const int COLOR_TABLE_SIZE = 256;
+
+/**
+ * Fills a lookup table for displaying intensity; black - blue - cyan
+ * - yellow - red - white.
+ */
+inline void fillColorTable(QRgb* table)
+{
+    const QColor stops[] = {Qt::black, Qt::blue, Qt::cyan,
+                            Qt::yellow, Qt::red, Qt::white};
+    const int numStops = sizeof(stops) / sizeof(stops[0]);
+    for (int i = 0; i < COLOR_TABLE_SIZE; i++)
+    {
+        double pos = i * (numStops - 1) / double(COLOR_TABLE_SIZE - 1);
+        int s = std::min((int) pos, numStops - 2);
+        double r = pos - s;
+        const QColor& c1 = stops[s];
+        const QColor& c2 = stops[s+1];
+        table[i] = qRgb(qRound(c1.red() + r * (c2.red() - c1.red())),
+                        qRound(c1.green() + r * (c2.green() - c1.green())),
+                        qRound(c1.blue() + r * (c2.blue() - c1.blue())));
+    }
+}
+
+#endif // COLORMAP_H
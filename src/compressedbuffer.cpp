@@ -0,0 +1,599 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "compressedbuffer.h"
+
+/// Integers bigger than this can't be represented exactly as double
+static const double MAX_EXACT_INT = 9007199254740992.; // 2^53
+
+namespace
+{
+
+/// Writes bits MSB first into a byte array
+class BitWriter
+{
+public:
+    explicit BitWriter(QByteArray* out) : _out(out), acc(0), nbits(0) {}
+
+    void write(quint64 bits, unsigned n)
+    {
+        while (n > 0)
+        {
+            unsigned room = 8 - nbits;
+            unsigned take = std::min(room, n);
+            quint8 chunk = (bits >> (n - take)) & ((1u << take) - 1);
+            acc = (acc << take) | chunk;
+            nbits += take;
+            n -= take;
+            if (nbits == 8)
+            {
+                _out->append(char(acc));
+                acc = 0;
+                nbits = 0;
+            }
+        }
+    }
+
+    void flush()
+    {
+        if (nbits) write(0, 8 - nbits);
+    }
+
+private:
+    QByteArray* _out;
+    quint8 acc;
+    unsigned nbits;
+};
+
+/// Reads bits written by `BitWriter`
+class BitReader
+{
+public:
+    explicit BitReader(const QByteArray& in) :
+        data((const quint8*) in.constData()), pos(0) {}
+
+    quint64 read(unsigned n)
+    {
+        quint64 r = 0;
+        while (n > 0)
+        {
+            unsigned bitInByte = pos & 7;
+            unsigned avail = 8 - bitInByte;
+            unsigned take = std::min(avail, n);
+            quint8 byte = data[pos >> 3];
+            quint64 chunk = (byte >> (avail - take)) & ((1u << take) - 1);
+            r = (r << take) | chunk;
+            pos += take;
+            n -= take;
+        }
+        return r;
+    }
+
+private:
+    const quint8* data;
+    size_t pos;                 ///< position in bits
+};
+
+inline quint64 toBits(double v)
+{
+    quint64 b;
+    memcpy(&b, &v, sizeof(b));
+    return b;
+}
+
+inline double fromBits(quint64 b)
+{
+    double v;
+    memcpy(&v, &b, sizeof(v));
+    return v;
+}
+
+inline quint64 zigzag(qint64 v)
+{
+    return (quint64(v) << 1) ^ quint64(v >> 63);
+}
+
+inline qint64 unzigzag(quint64 v)
+{
+    return qint64(v >> 1) ^ -qint64(v & 1);
+}
+
+inline unsigned clz64(quint64 x)
+{
+    unsigned n = 0;
+    for (quint64 m = quint64(1) << 63; m && !(x & m); m >>= 1) n++;
+    return n;
+}
+
+inline unsigned ctz64(quint64 x)
+{
+    unsigned n = 0;
+    for (; n < 64 && !(x & 1); x >>= 1) n++;
+    return n;
+}
+
+} // namespace
+
+CompressedBuffer::CompressedBuffer(unsigned n)
+{
+    _size = n;
+    _numValid = 0;
+    firstBlockId = 0;
+    tail = new double[BLOCK_SIZE];
+    tailCount = 0;
+    skip = 0;
+
+    cacheTick = 0;
+    for (auto& entry : cache)
+    {
+        entry.blockId = 0;
+        entry.valid = false;
+        entry.lastUse = 0;
+        entry.data = new double[BLOCK_SIZE];
+    }
+
+    limInvalid = false;
+    limCache = {0, 0};
+}
+
+CompressedBuffer::~CompressedBuffer()
+{
+    delete[] tail;
+    for (auto& entry : cache)
+    {
+        delete[] entry.data;
+    }
+}
+
+unsigned CompressedBuffer::size() const
+{
+    return _size;
+}
+
+unsigned CompressedBuffer::numValid() const
+{
+    return _numValid;
+}
+
+unsigned CompressedBuffer::numStored() const
+{
+    return blocks.size() * BLOCK_SIZE + tailCount;
+}
+
+size_t CompressedBuffer::memoryUsage() const
+{
+    size_t r = (BLOCK_SIZE * (CACHE_SIZE + 1)) * sizeof(double);
+    for (auto& block : blocks)
+    {
+        r += block.data.size() + sizeof(Block);
+    }
+    return r;
+}
+
+double CompressedBuffer::sample(unsigned i) const
+{
+    // invalid samples are read as 0
+    if (i < _size - _numValid) return 0.;
+
+    unsigned j = i - (_size - _numValid) + skip;
+    unsigned bi = j / BLOCK_SIZE;
+    if (bi < blocks.size())
+    {
+        return blockData(bi)[j % BLOCK_SIZE];
+    }
+    else
+    {
+        return tail[j - blocks.size() * BLOCK_SIZE];
+    }
+}
+
+Range CompressedBuffer::limits() const
+{
+    if (limInvalid) updateLimits();
+    return limCache;
+}
+
+Range CompressedBuffer::rangeLimits(unsigned start, unsigned end) const
+{
+    Q_ASSERT(start < end && end <= _size);
+
+    Range r;
+    bool first = true;
+    auto merge = [&r, &first](Range m)
+        {
+            if (first)
+            {
+                r = m;
+                first = false;
+            }
+            else
+            {
+                r.start = std::min(r.start, m.start);
+                r.end = std::max(r.end, m.end);
+            }
+        };
+    auto scan = [&merge](const double* data, unsigned from, unsigned to)
+        {
+            if (from >= to) return;
+            Range m = {data[from], data[from]};
+            for (unsigned i = from + 1; i < to; i++)
+            {
+                if (data[i] < m.start) m.start = data[i];
+                else if (data[i] > m.end) m.end = data[i];
+            }
+            merge(m);
+        };
+
+    // invalid samples are read as 0
+    unsigned firstValid = _size - _numValid;
+    if (start < firstValid)
+    {
+        merge({0, 0});
+        start = firstValid;
+        if (start >= end) return r;
+    }
+
+    // convert to indexes in stored data
+    unsigned j = start - firstValid + skip;
+    unsigned jEnd = end - firstValid + skip;
+    unsigned blocksEnd = blocks.size() * BLOCK_SIZE;
+
+    while (j < jEnd && j < blocksEnd)
+    {
+        unsigned bi = j / BLOCK_SIZE;
+        unsigned from = j % BLOCK_SIZE;
+        unsigned to = std::min(jEnd - bi * BLOCK_SIZE, (unsigned) BLOCK_SIZE);
+        if (from == 0 && to == BLOCK_SIZE)
+        {
+            // whole block is in range, no need to decompress
+            merge(blocks[bi].limits);
+        }
+        else
+        {
+            scan(blockData(bi), from, to);
+        }
+        j = (bi + 1) * BLOCK_SIZE;
+    }
+
+    if (j < jEnd)
+    {
+        scan(tail, j - blocksEnd, jEnd - blocksEnd);
+    }
+
+    return r;
+}
+
+void CompressedBuffer::resize(unsigned n)
+{
+    Q_ASSERT(n != _size);
+
+    _size = n;
+    if (_numValid > n)
+    {
+        _numValid = n;
+        skip = numStored() - _numValid;
+        dropOldBlocks();
+    }
+
+    limInvalid = true;
+}
+
+void CompressedBuffer::addSamples(double* samples, unsigned n)
+{
+    // older samples wouldn't fit anyway
+    if (n >= _size)
+    {
+        clear();
+        samples += n - _size;
+        n = _size;
+    }
+
+    unsigned remaining = n;
+    while (remaining)
+    {
+        unsigned count = std::min(remaining, BLOCK_SIZE - tailCount);
+        memcpy(&tail[tailCount], samples, count * sizeof(double));
+        tailCount += count;
+        samples += count;
+        remaining -= count;
+
+        if (tailCount == BLOCK_SIZE) compressTail();
+    }
+
+    _numValid = std::min(_numValid + n, _size);
+    skip = numStored() - _numValid;
+    dropOldBlocks();
+
+    limInvalid = true;
+}
+
+void CompressedBuffer::clear()
+{
+    blocks.clear();
+    firstBlockId = 0;
+    tailCount = 0;
+    skip = 0;
+    _numValid = 0;
+
+    for (auto& entry : cache)
+    {
+        entry.valid = false;
+    }
+
+    limCache = {0, 0};
+    limInvalid = false;
+}
+
+void CompressedBuffer::dropOldBlocks()
+{
+    while (skip >= BLOCK_SIZE && !blocks.empty())
+    {
+        blocks.pop_front();
+        firstBlockId++;
+        skip -= BLOCK_SIZE;
+    }
+}
+
+void CompressedBuffer::compressTail()
+{
+    Q_ASSERT(tailCount == BLOCK_SIZE);
+
+    Block block;
+    block.limits = {tail[0], tail[0]};
+
+    bool isInteger = true;
+    for (unsigned i = 0; i < BLOCK_SIZE; i++)
+    {
+        double v = tail[i];
+        if (v < block.limits.start) block.limits.start = v;
+        if (v > block.limits.end) block.limits.end = v;
+        if (isInteger && !(std::trunc(v) == v && std::fabs(v) <= MAX_EXACT_INT))
+        {
+            isInteger = false;
+        }
+    }
+
+    if (isInteger)
+    {
+        block.encoding = Encoding::Integer;
+        encodeInteger(tail, BLOCK_SIZE, block.data);
+    }
+    else
+    {
+        block.encoding = Encoding::Float;
+        encodeFloat(tail, BLOCK_SIZE, block.data);
+    }
+    block.data.squeeze();
+
+    blocks.push_back(std::move(block));
+    tailCount = 0;
+}
+
+const double* CompressedBuffer::blockData(unsigned blockIndex) const
+{
+    quint64 id = firstBlockId + blockIndex;
+    cacheTick++;
+
+    // look up cache, remember the least recently used entry
+    CacheEntry* lru = &cache[0];
+    for (auto& entry : cache)
+    {
+        if (entry.valid && entry.blockId == id)
+        {
+            entry.lastUse = cacheTick;
+            return entry.data;
+        }
+        if (!entry.valid || entry.lastUse < lru->lastUse)
+        {
+            lru = &entry;
+        }
+    }
+
+    // decompress into the evicted entry
+    auto& block = blocks[blockIndex];
+    if (block.encoding == Encoding::Integer)
+    {
+        decodeInteger(block.data, lru->data, BLOCK_SIZE);
+    }
+    else
+    {
+        decodeFloat(block.data, lru->data, BLOCK_SIZE);
+    }
+    lru->blockId = id;
+    lru->valid = true;
+    lru->lastUse = cacheTick;
+
+    return lru->data;
+}
+
+void CompressedBuffer::updateLimits() const
+{
+    limInvalid = false;
+
+    if (!_numValid)
+    {
+        limCache = {0, 0};
+        return;
+    }
+
+    bool first = true;
+    auto merge = [this, &first](Range r)
+        {
+            if (first)
+            {
+                limCache = r;
+                first = false;
+            }
+            else
+            {
+                limCache.start = std::min(limCache.start, r.start);
+                limCache.end = std::max(limCache.end, r.end);
+            }
+        };
+    auto scan = [&merge](const double* data, unsigned from, unsigned to)
+        {
+            if (from >= to) return;
+            Range r = {data[from], data[from]};
+            for (unsigned i = from + 1; i < to; i++)
+            {
+                if (data[i] < r.start) r.start = data[i];
+                else if (data[i] > r.end) r.end = data[i];
+            }
+            merge(r);
+        };
+
+    // only first stored block can be partially out of window
+    for (unsigned bi = 0; bi < blocks.size(); bi++)
+    {
+        if (bi == 0 && skip > 0)
+        {
+            scan(blockData(0), skip, BLOCK_SIZE);
+        }
+        else
+        {
+            merge(blocks[bi].limits);
+        }
+    }
+
+    scan(tail, blocks.empty() ? skip : 0, tailCount);
+}
+
+void CompressedBuffer::encodeInteger(const double* samples, unsigned n, QByteArray& out)
+{
+    qint64 prev = 0;
+    for (unsigned i = 0; i < n; i++)
+    {
+        qint64 v = qint64(samples[i]);
+        quint64 z = zigzag(v - prev);
+        prev = v;
+
+        // varint, 7 bits per byte, MSB set if more bytes follow
+        while (z >= 0x80)
+        {
+            out.append(char((z & 0x7F) | 0x80));
+            z >>= 7;
+        }
+        out.append(char(z));
+    }
+}
+
+void CompressedBuffer::decodeInteger(const QByteArray& in, double* samples, unsigned n)
+{
+    const quint8* p = (const quint8*) in.constData();
+    qint64 prev = 0;
+    for (unsigned i = 0; i < n; i++)
+    {
+        quint64 z = 0;
+        unsigned shift = 0;
+        quint8 byte;
+        do
+        {
+            byte = *p++;
+            z |= quint64(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        prev += unzigzag(z);
+        samples[i] = double(prev);
+    }
+}
+
+/*
+ * Float encoding is based on the Facebook Gorilla paper. Each value
+ * is XOR'ed with the previous one:
+ *
+ * - '0' : same value as previous
+ * - '10': meaningful bits fit in the previous window, followed by bits
+ * - '11': 5 bits leading zeros, 6 bits (length - 1), followed by bits
+ */
+void CompressedBuffer::encodeFloat(const double* samples, unsigned n, QByteArray& out)
+{
+    BitWriter w(&out);
+
+    quint64 prev = toBits(samples[0]);
+    w.write(prev, 64);
+
+    unsigned prevLeading = 65;  // no previous window
+    unsigned prevTrailing = 0;
+
+    for (unsigned i = 1; i < n; i++)
+    {
+        quint64 cur = toBits(samples[i]);
+        quint64 x = cur ^ prev;
+        prev = cur;
+
+        if (x == 0)
+        {
+            w.write(0, 1);
+            continue;
+        }
+
+        unsigned leading = std::min(clz64(x), 31u);
+        unsigned trailing = ctz64(x);
+
+        if (prevLeading <= 64 && leading >= prevLeading && trailing >= prevTrailing)
+        {
+            w.write(0x2, 2);
+            w.write(x >> prevTrailing, 64 - prevLeading - prevTrailing);
+        }
+        else
+        {
+            unsigned length = 64 - leading - trailing;
+            w.write(0x3, 2);
+            w.write(leading, 5);
+            w.write(length - 1, 6);
+            w.write(x >> trailing, length);
+            prevLeading = leading;
+            prevTrailing = trailing;
+        }
+    }
+
+    w.flush();
+}
+
+void CompressedBuffer::decodeFloat(const QByteArray& in, double* samples, unsigned n)
+{
+    BitReader r(in);
+
+    quint64 prev = r.read(64);
+    samples[0] = fromBits(prev);
+
+    unsigned leading = 0;
+    unsigned trailing = 0;
+
+    for (unsigned i = 1; i < n; i++)
+    {
+        if (r.read(1))
+        {
+            if (r.read(1))  // new window
+            {
+                leading = r.read(5);
+                unsigned length = r.read(6) + 1;
+                trailing = 64 - leading - length;
+            }
+            quint64 x = r.read(64 - leading - trailing) << trailing;
+            prev ^= x;
+        }
+        samples[i] = fromBits(prev);
+    }
+}
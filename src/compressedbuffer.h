@@ -0,0 +1,122 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPRESSEDBUFFER_H
+#define COMPRESSEDBUFFER_H
+
+#include <deque>
+#include <QByteArray>
+#include <QtGlobal>
+
+#include "framebuffer.h"
+
+/**
+ * A frame buffer that stores older samples compressed. Intended for
+ * long captures of slow changing signals.
+ *
+ * Incoming samples are collected in an uncompressed "tail" block. When
+ * the tail is full it's compressed into a fixed size block. Blocks
+ * that contain only integer values are encoded as delta + zigzag +
+ * varint, others are encoded with Gorilla style XOR encoding.
+ *
+ * Minimum and maximum of each block is stored so that `limits()`
+ * doesn't require decompression. A small cache of decompressed blocks
+ * serves `sample()` calls.
+ *
+ * Like `RingBuffer` only the last `size()` samples are kept.
+ */
+class CompressedBuffer : public WFrameBuffer
+{
+public:
+    /// Number of samples in a compressed block
+    static const unsigned BLOCK_SIZE = 1024;
+
+    CompressedBuffer(unsigned n);
+    ~CompressedBuffer();
+
+    unsigned size() const override;
+    double sample(unsigned i) const override;
+    Range limits() const override;
+    /// Uses stored block limits for blocks that are fully in range
+    Range rangeLimits(unsigned start, unsigned end) const override;
+    unsigned numValid() const override;
+    void resize(unsigned n) override;
+    void addSamples(double* samples, unsigned n) override;
+    void clear() override;
+
+    /// Returns the memory used by data, in bytes
+    size_t memoryUsage() const;
+
+private:
+    /// Number of blocks kept in decompressed cache
+    static const unsigned CACHE_SIZE = 4;
+
+    enum class Encoding : quint8
+    {
+        Integer,    ///< delta + zigzag + varint
+        Float       ///< XOR with previous value
+    };
+
+    struct Block
+    {
+        Encoding encoding;
+        QByteArray data;
+        Range limits;
+    };
+
+    struct CacheEntry
+    {
+        quint64 blockId;        ///< absolute id of the cached block
+        bool valid;
+        unsigned lastUse;       ///< for LRU eviction
+        double* data;
+    };
+
+    unsigned _size;
+    unsigned _numValid;
+    std::deque<Block> blocks;  ///< compressed blocks, oldest first
+    quint64 firstBlockId;      ///< absolute id of `blocks.front()`
+    double* tail;              ///< uncompressed newest samples
+    unsigned tailCount;        ///< number of samples in `tail`
+    /// Number of (out of window) samples to skip at the start of the stored data
+    unsigned skip;
+
+    mutable CacheEntry cache[CACHE_SIZE];
+    mutable unsigned cacheTick;
+
+    mutable bool limInvalid;   ///< Indicates that limits needs to be re-calculated
+    mutable Range limCache;    ///< Cache for limits()
+    void updateLimits() const; ///< Updates limits cache
+
+    /// Total number of samples stored including the skipped ones
+    unsigned numStored() const;
+    /// Drops blocks that are completely out of the window
+    void dropOldBlocks();
+    /// Compresses the tail into a new block
+    void compressTail();
+    /// Returns decompressed data of a block, from cache if possible
+    const double* blockData(unsigned blockIndex) const;
+
+    static void encodeInteger(const double* samples, unsigned n, QByteArray& out);
+    static void decodeInteger(const QByteArray& in, double* samples, unsigned n);
+    static void encodeFloat(const double* samples, unsigned n, QByteArray& out);
+    static void decodeFloat(const QByteArray& in, double* samples, unsigned n);
+};
+
+#endif // COMPRESSEDBUFFER_H
@@ -0,0 +1,387 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <QtDebug>
+#include <QtEndian>
+
+#include "compressedfile.h"
+
+static const char MAGIC[] = "SPZBLOCK";
+static const int MAGIC_SIZE = 8;
+static const quint32 VERSION = 1;
+static const unsigned HEADER_SIZE = 16;
+static const unsigned BLOCK_HEADER_SIZE = 16;
+
+CompressedFile::CompressedFile(QObject* parent) :
+    QIODevice(parent)
+{
+    _size = 0;
+    busy = false;
+    quit = false;
+    writeError = false;
+    writeOffset = 0;
+    thread = nullptr;
+    _compressedBytes = 0;
+    _uncompressedBytes = 0;
+    currentBlock = -1;
+}
+
+CompressedFile::~CompressedFile()
+{
+    if (isOpen()) close();
+}
+
+bool CompressedFile::isCompressedFile(QIODevice* device)
+{
+    return device->peek(MAGIC_SIZE) == QByteArray(MAGIC, MAGIC_SIZE);
+}
+
+void CompressedFile::setFileName(const QString& fileName)
+{
+    Q_ASSERT(!isOpen());
+    file.setFileName(fileName);
+}
+
+bool CompressedFile::open(OpenMode mode)
+{
+    Q_ASSERT(!isOpen());
+    // text mode is handled by QIODevice
+    OpenMode access = mode & ~(QIODevice::Text | QIODevice::Unbuffered);
+    if (access == QIODevice::ReadOnly)
+    {
+        if (!openRead()) return false;
+    }
+    else if (access == QIODevice::WriteOnly)
+    {
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            setErrorString(file.errorString());
+            return false;
+        }
+
+        char header[HEADER_SIZE];
+        memcpy(header, MAGIC, MAGIC_SIZE);
+        qToLittleEndian(VERSION, header + 8);
+        qToLittleEndian(quint32(0), header + 12);
+        if (file.write(header, HEADER_SIZE) != HEADER_SIZE)
+        {
+            setErrorString(file.errorString());
+            file.close();
+            return false;
+        }
+
+        _size = 0;
+        block.clear();
+        block.reserve(BLOCK_SIZE);
+        busy = false;
+        quit = false;
+        writeError = false;
+        writeOffset = 0;
+        _compressedBytes = HEADER_SIZE;
+        _uncompressedBytes = 0;
+        thread = QThread::create([this]() {run();});
+        thread->start();
+    }
+    else
+    {
+        setErrorString(tr("Unsupported open mode"));
+        return false;
+    }
+
+    // blocks are already buffered
+    return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+bool CompressedFile::openRead()
+{
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        setErrorString(file.errorString());
+        return false;
+    }
+
+    QByteArray header = file.read(HEADER_SIZE);
+    if (header.size() != HEADER_SIZE || !header.startsWith(QByteArray(MAGIC, MAGIC_SIZE)))
+    {
+        setErrorString(tr("Not a compressed file"));
+        file.close();
+        return false;
+    }
+    if (qFromLittleEndian<quint32>(header.constData() + 8) != VERSION)
+    {
+        setErrorString(tr("Unsupported compressed file version"));
+        file.close();
+        return false;
+    }
+
+    // walk block headers, stop at an incomplete block
+    blocks.clear();
+    currentBlock = -1;
+    const qint64 fileSize = file.size();
+    qint64 pos = HEADER_SIZE;
+    qint64 offset = 0;
+    while (pos + BLOCK_HEADER_SIZE <= fileSize)
+    {
+        file.seek(pos);
+        QByteArray bh = file.read(BLOCK_HEADER_SIZE);
+        if (bh.size() != BLOCK_HEADER_SIZE) break;
+
+        BlockInfo info;
+        info.filePos = pos + BLOCK_HEADER_SIZE;
+        info.compressedSize = qFromLittleEndian<quint32>(bh.constData());
+        info.size = qFromLittleEndian<quint32>(bh.constData() + 4);
+        info.offset = qFromLittleEndian<qint64>(bh.constData() + 8);
+        if (info.offset != offset || info.filePos + info.compressedSize > fileSize) break;
+
+        if (info.size) blocks.push_back(info);
+        offset += info.size;
+        pos = info.filePos + info.compressedSize;
+    }
+
+    if (pos != fileSize)
+    {
+        qWarning() << "Compressed file" << file.fileName()
+                   << "is truncated, last incomplete block is ignored";
+    }
+
+    _size = offset;
+    return true;
+}
+
+void CompressedFile::close()
+{
+    if (!isOpen()) return;
+
+    if (openMode() & QIODevice::WriteOnly)
+    {
+        if (!block.isEmpty()) queueBlock();
+        {
+            QMutexLocker locker(&mutex);
+            quit = true;
+            notEmpty.wakeAll();
+        }
+        thread->wait();
+        delete thread;
+        thread = nullptr;
+    }
+    else
+    {
+        blocks.clear();
+        currentBlock = -1;
+    }
+
+    block = QByteArray();
+    file.close();
+    QIODevice::close();
+}
+
+bool CompressedFile::seek(qint64 pos)
+{
+    if (openMode() & QIODevice::WriteOnly)
+    {
+        return pos == this->pos();
+    }
+    return QIODevice::seek(pos);
+}
+
+qint64 CompressedFile::size() const
+{
+    return _size;
+}
+
+bool CompressedFile::flush()
+{
+    Q_ASSERT(openMode() & QIODevice::WriteOnly);
+
+    if (!block.isEmpty()) queueBlock();
+
+    QMutexLocker locker(&mutex);
+    while (!queue.empty() || busy)
+    {
+        drained.wait(&mutex);
+    }
+    return !writeError && file.flush();
+}
+
+int CompressedFile::handle() const
+{
+    return file.handle();
+}
+
+qint64 CompressedFile::compressedBytes() const
+{
+    return _compressedBytes;
+}
+
+qint64 CompressedFile::uncompressedBytes() const
+{
+    return _uncompressedBytes;
+}
+
+unsigned CompressedFile::numBlocks() const
+{
+    return blocks.size();
+}
+
+qint64 CompressedFile::writeData(const char* data, qint64 maxSize)
+{
+    {
+        QMutexLocker locker(&mutex);
+        if (writeError)
+        {
+            setErrorString(file.errorString());
+            return -1;
+        }
+    }
+
+    qint64 written = 0;
+    while (written < maxSize)
+    {
+        qint64 n = std::min(maxSize - written, qint64(BLOCK_SIZE - block.size()));
+        block.append(data + written, n);
+        written += n;
+        if (block.size() == qsizetype(BLOCK_SIZE)) queueBlock();
+    }
+
+    _size += written;
+    return written;
+}
+
+void CompressedFile::queueBlock()
+{
+    QMutexLocker locker(&mutex);
+    while (queue.size() >= MAX_QUEUED_BLOCKS && !writeError)
+    {
+        notFull.wait(&mutex);
+    }
+
+    queue.push_back(std::move(block));
+    notEmpty.wakeOne();
+    locker.unlock();
+
+    block = QByteArray();
+    block.reserve(BLOCK_SIZE);
+}
+
+void CompressedFile::run()
+{
+    QMutexLocker locker(&mutex);
+    while (true)
+    {
+        while (queue.empty() && !quit)
+        {
+            notEmpty.wait(&mutex);
+        }
+        if (queue.empty()) break; // quit requested and everything is written
+
+        QByteArray data = std::move(queue.front());
+        queue.pop_front();
+        busy = true;
+        notFull.wakeAll();
+        // after an error blocks are discarded
+        bool failed = writeError;
+
+        locker.unlock();
+        bool ok = !failed && writeBlock(data);
+        locker.relock();
+
+        busy = false;
+        if (!ok && !writeError)
+        {
+            writeError = true;
+            notFull.wakeAll();
+        }
+        if (queue.empty()) drained.wakeAll();
+    }
+}
+
+bool CompressedFile::writeBlock(const QByteArray& data)
+{
+    QByteArray compressed = qCompress(data);
+
+    char header[BLOCK_HEADER_SIZE];
+    qToLittleEndian(quint32(compressed.size()), header);
+    qToLittleEndian(quint32(data.size()), header + 4);
+    qToLittleEndian(qint64(writeOffset), header + 8);
+
+    if (file.write(header, BLOCK_HEADER_SIZE) != BLOCK_HEADER_SIZE ||
+        file.write(compressed) != compressed.size())
+    {
+        qCritical() << "Writing compressed file failed:" << file.errorString();
+        return false;
+    }
+
+    writeOffset += data.size();
+    _compressedBytes += BLOCK_HEADER_SIZE + compressed.size();
+    _uncompressedBytes += data.size();
+    return true;
+}
+
+unsigned CompressedFile::blockAt(qint64 pos) const
+{
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), pos,
+                               [](qint64 p, const BlockInfo& b) {return p < b.offset;});
+    return std::distance(blocks.begin(), it) - 1;
+}
+
+bool CompressedFile::loadBlock(unsigned i)
+{
+    if (currentBlock == int(i)) return true;
+
+    const BlockInfo& info = blocks[i];
+    currentBlock = -1;
+    if (!file.seek(info.filePos))
+    {
+        setErrorString(file.errorString());
+        return false;
+    }
+    block = qUncompress(file.read(info.compressedSize));
+    if (block.size() != qsizetype(info.size))
+    {
+        setErrorString(tr("Corrupted block at %1").arg(info.filePos));
+        return false;
+    }
+
+    currentBlock = i;
+    return true;
+}
+
+qint64 CompressedFile::readData(char* data, qint64 maxSize)
+{
+    qint64 p = pos();
+    qint64 done = 0;
+    while (done < maxSize && p < _size)
+    {
+        unsigned i = currentBlock >= 0 &&
+            p >= blocks[currentBlock].offset &&
+            p < blocks[currentBlock].offset + blocks[currentBlock].size ?
+            currentBlock : blockAt(p);
+        if (!loadBlock(i)) return done ? done : -1;
+
+        const BlockInfo& info = blocks[i];
+        qint64 inBlock = p - info.offset;
+        qint64 n = std::min(maxSize - done, qint64(info.size) - inBlock);
+        memcpy(data + done, block.constData() + inBlock, n);
+        done += n;
+        p += n;
+    }
+    return done;
+}
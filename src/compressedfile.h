@@ -0,0 +1,154 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPRESSEDFILE_H
+#define COMPRESSEDFILE_H
+
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <QFile>
+#include <QIODevice>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+/**
+ * A file device that stores data as independently compressed zlib
+ * (`qCompress`) blocks.
+ *
+ * In write mode data is collected into blocks of `BLOCK_SIZE`
+ * bytes. Full blocks are compressed and written to the file on a
+ * worker thread, so the writer only pays for a copy. If the worker
+ * falls behind by `MAX_QUEUED_BLOCKS` blocks, writer waits.
+ *
+ * Each block has a header with its compressed size, uncompressed
+ * size and uncompressed offset. A file cut short by a crash can be
+ * read up to the last complete block. In read mode the device is
+ * seekable, only the block containing the read position is
+ * decompressed.
+ *
+ * File layout, integers are little endian:
+ *
+ *     header: "SPZBLOCK", u32 version, u32 reserved
+ *     block:  u32 compressed size, u32 size, u64 offset, qCompress data
+ *     block:  ...
+ */
+class CompressedFile : public QIODevice
+{
+    Q_OBJECT
+
+public:
+    /// Uncompressed size of a full block
+    static const unsigned BLOCK_SIZE = 1024 * 1024;
+    /// Maximum number of blocks waiting to be compressed
+    static const unsigned MAX_QUEUED_BLOCKS = 8;
+
+    explicit CompressedFile(QObject* parent = nullptr);
+    ~CompressedFile();
+
+    /// Checks if device starts with a compressed file header. Read
+    /// position isn't changed.
+    static bool isCompressedFile(QIODevice* device);
+
+    /// Should be set before `open()`
+    void setFileName(const QString& fileName);
+
+    /// Opens the file. Only `ReadOnly` or `WriteOnly` are supported.
+    bool open(OpenMode mode) override;
+    /// Writes remaining data and waits for the worker before closing
+    void close() override;
+    /// Seeking is only supported in read mode
+    bool seek(qint64 pos) override;
+    /// Uncompressed size
+    qint64 size() const override;
+
+    /**
+     * Compresses the partially filled block and waits until all
+     * blocks are written to the file. Too frequent calls will hurt
+     * compression ratio.
+     *
+     * @return false if writing failed
+     */
+    bool flush();
+    /// Returns file handle, see `QFileDevice::handle()`
+    int handle() const;
+
+    /// Number of bytes written to the file, can be called from any thread
+    qint64 compressedBytes() const;
+    /// Number of bytes compressed and written to the file, can be
+    /// called from any thread
+    qint64 uncompressedBytes() const;
+
+    /// Number of complete blocks, only valid in read mode
+    unsigned numBlocks() const;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    struct BlockInfo
+    {
+        qint64 filePos;         ///< position of compressed data in file
+        quint32 compressedSize;
+        quint32 size;           ///< uncompressed size
+        qint64 offset;          ///< uncompressed offset
+    };
+
+    QFile file;
+    qint64 _size;               ///< uncompressed size
+
+    /// Block being filled in write mode, decompressed `currentBlock`
+    /// in read mode
+    QByteArray block;
+
+    // write mode
+    QMutex mutex;
+    QWaitCondition notEmpty;
+    QWaitCondition notFull;
+    QWaitCondition drained;
+    std::deque<QByteArray> queue;
+    bool busy;                  ///< worker is writing a block
+    bool quit;
+    bool writeError;
+    qint64 writeOffset;         ///< uncompressed offset of next written block
+    QThread* thread;
+    std::atomic<qint64> _compressedBytes;
+    std::atomic<qint64> _uncompressedBytes;
+
+    /// Hands over `block` to the worker
+    void queueBlock();
+    /// Worker thread loop
+    void run();
+    /// Compresses and writes a block, called from worker thread
+    bool writeBlock(const QByteArray& data);
+
+    // read mode
+    std::vector<BlockInfo> blocks;
+    int currentBlock;           ///< -1 if `block` isn't loaded
+
+    bool openRead();
+    /// Returns index of block containing `pos`
+    unsigned blockAt(qint64 pos) const;
+    /// Decompresses block into `block`
+    bool loadBlock(unsigned i);
+};
+
+#endif // COMPRESSEDFILE_H
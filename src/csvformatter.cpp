@@ -0,0 +1,145 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+#include "csvformatter.h"
+
+CsvFormatter::CsvFormatter()
+{
+    length = 0;
+    _decimals = 6;
+    le = "\n";
+}
+
+void CsvFormatter::setDecimals(unsigned decimals)
+{
+    _decimals = decimals < MAX_DECIMALS ? decimals : MAX_DECIMALS;
+}
+
+void CsvFormatter::setSeparator(const QString& separator)
+{
+    sep = separator.toUtf8();
+}
+
+void CsvFormatter::setLineEnding(const char* lineEnding)
+{
+    le = lineEnding;
+}
+
+const char* CsvFormatter::data() const
+{
+    return buffer.data();
+}
+
+size_t CsvFormatter::size() const
+{
+    return length;
+}
+
+void CsvFormatter::clear()
+{
+    length = 0;
+}
+
+void CsvFormatter::appendRows(const double* const* columns, unsigned numColumns,
+                              unsigned numSamples, const QByteArray& prefix)
+{
+    // enough room for any row
+    const size_t rowMax = prefix.size() + le.size() +
+        size_t(numColumns) * (MAX_NUMBER_LENGTH + sep.size());
+
+    for (unsigned i = 0; i < numSamples; i++)
+    {
+        if (buffer.size() < length + rowMax) buffer.resize(length + rowMax);
+
+        char* p = buffer.data() + length;
+        memcpy(p, prefix.constData(), prefix.size());
+        p += prefix.size();
+        for (unsigned ci = 0; ci < numColumns; ci++)
+        {
+            if (ci)
+            {
+                memcpy(p, sep.constData(), sep.size());
+                p += sep.size();
+            }
+            p = formatNumber(columns[ci][i], _decimals, p);
+        }
+        memcpy(p, le.constData(), le.size());
+        p += le.size();
+
+        length = p - buffer.data();
+    }
+}
+
+/// Returns true if `value` is exactly halfway between two numbers
+/// with `decimals` digits after the decimal point.
+static bool isTie(double value, unsigned decimals)
+{
+    // A tie has exactly `decimals+1` fractional decimal digits, last
+    // one being 5. That's when value is n/2^(decimals+1) with n odd.
+    double y = std::ldexp(value, decimals + 1);
+    return std::fabs(y) < 9007199254740992.0 && // 2^53, larger ones are even
+        y == std::trunc(y) && std::fmod(y, 2.0) != 0;
+}
+
+char* CsvFormatter::formatNumber(double value, unsigned decimals, char* out)
+{
+    if (std::isnan(value))
+    {
+        memcpy(out, "nan", 3);
+        return out + 3;
+    }
+
+    if (value == 0) value = 0.; // `QTextStream` doesn't write "-0"
+
+    char* const end = out + MAX_NUMBER_LENGTH;
+    if (!isTie(value, decimals))
+    {
+        return std::to_chars(out, end, value, std::chars_format::fixed, decimals).ptr;
+    }
+
+    // `to_chars` rounds ties to even, `QTextStream` rounds them away
+    // from zero. Write exact value and round up the digits by hand.
+    char* p = std::to_chars(out, end, value, std::chars_format::fixed, decimals + 1).ptr;
+    p--;                        // drop the last digit, it's '5'
+    if (!decimals) p--;         // drop '.'
+
+    char* d = p - 1;
+    while (d >= out && (*d == '9' || *d == '.'))
+    {
+        if (*d == '9') *d = '0';
+        d--;
+    }
+    if (d >= out && *d != '-')
+    {
+        (*d)++;
+    }
+    else                        // carry out of the most significant digit
+    {
+        d++;
+        memmove(d + 1, d, p - d);
+        *d = '1';
+        p++;
+    }
+
+    return p;
+}
@@ -0,0 +1,83 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CSVFORMATTER_H
+#define CSVFORMATTER_H
+
+#include <vector>
+#include <QByteArray>
+#include <QString>
+
+/**
+ * Formats samples as CSV rows into a reusable byte buffer.
+ *
+ * Numbers are written in fixed notation with `std::to_chars`. Output
+ * is identical to `QTextStream` with `FixedNotation` and C locale,
+ * including rounding of ties away from zero.
+ */
+class CsvFormatter
+{
+public:
+    /// Maximum number of digits after decimal point
+    static const unsigned MAX_DECIMALS = 100;
+    /// Maximum length of a formatted number
+    static const unsigned MAX_NUMBER_LENGTH = 320 + MAX_DECIMALS;
+
+    CsvFormatter();
+
+    /// Number of digits after decimal point, default is 6
+    void setDecimals(unsigned decimals);
+    void setSeparator(const QString& separator);
+    /// Default is "\n"
+    void setLineEnding(const char* lineEnding);
+
+    /**
+     * Formats rows and appends them to the buffer.
+     *
+     * @param columns data of each column
+     * @param numColumns number of columns
+     * @param numSamples number of samples in each column
+     * @param prefix written at the start of every row, can be empty
+     */
+    void appendRows(const double* const* columns, unsigned numColumns,
+                    unsigned numSamples, const QByteArray& prefix = QByteArray());
+
+    const char* data() const;
+    /// Number of bytes in buffer
+    size_t size() const;
+    /// Clears the buffer, memory is kept for reuse
+    void clear();
+
+    /**
+     * Formats a single number into `out`.
+     *
+     * @param out must have room for `MAX_NUMBER_LENGTH` characters
+     * @return end of written characters
+     */
+    static char* formatNumber(double value, unsigned decimals, char* out);
+
+private:
+    std::vector<char> buffer;
+    size_t length;              ///< used part of the buffer
+    unsigned _decimals;
+    QByteArray sep;
+    QByteArray le;
+};
+
+#endif // CSVFORMATTER_H
@@ -0,0 +1,209 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <QPainter>
+#include <qwt_plot.h>
+#include <qwt_plot_canvas.h>
+
+#include "curvecache.h"
+
+static bool sameMap(const QwtScaleMap& a, const QwtScaleMap& b)
+{
+    return a.s1() == b.s1() && a.s2() == b.s2() &&
+        a.p1() == b.p1() && a.p2() == b.p2();
+}
+
+CurveCache::CurveCache()
+{
+    valid = false;
+    pendingShift = 0;
+    residual = 0;
+    setZ(20);                   // same as curves
+}
+
+int CurveCache::rtti() const
+{
+    return Rtti_CurveCache;
+}
+
+void CurveCache::shift(unsigned numSamples)
+{
+    pendingShift += numSamples;
+}
+
+void CurveCache::invalidate()
+{
+    valid = false;
+}
+
+QList<const FrameBufferCurve*> CurveCache::curves() const
+{
+    QList<const FrameBufferCurve*> list;
+    for (auto item : plot()->itemList(QwtPlotItem::Rtti_PlotCurve))
+    {
+        auto curve = dynamic_cast<const FrameBufferCurve*>(item);
+        if (curve != nullptr && curve->isVisible() && curve->isCached())
+        {
+            list.append(curve);
+        }
+    }
+    return list;
+}
+
+double CurveCache::sampleWidth(const QList<const FrameBufferCurve*>& list,
+                               const QwtScaleMap& xMap) const
+{
+    // all curves share the same X buffer
+    auto x = list.first()->series()->xData();
+    unsigned n = x->size();
+    if (n < 2) return 0;
+
+    return (xMap.transform(x->sample(n-1)) - xMap.transform(x->sample(0))) / (n-1);
+}
+
+void CurveCache::drawCurves(QPainter* painter, const QList<const FrameBufferCurve*>& list,
+                            const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                            const QRectF& canvasRect, double left, double right) const
+{
+    for (auto curve : list)
+    {
+        int from, to;
+        if (!curve->series()->indexRange(xMap.invTransform(left),
+                                         xMap.invTransform(right), from, to))
+        {
+            continue;
+        }
+
+        painter->setRenderHint(QPainter::Antialiasing,
+                               curve->testRenderHint(QwtPlotItem::RenderAntialiased));
+        curve->drawSeries(painter, xMap, yMap, canvasRect, from, to);
+    }
+}
+
+void CurveCache::scrollImage(int dx) const
+{
+    if (dx <= 0) return;
+
+    int width = image.width();
+    if (dx >= width) return;
+
+    for (int y = 0; y < image.height(); y++)
+    {
+        auto line = reinterpret_cast<quint32*>(image.scanLine(y));
+        memmove(line, line + dx, (width - dx) * sizeof(quint32));
+    }
+}
+
+void CurveCache::render(const QList<const FrameBufferCurve*>& list,
+                        const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                        const QRectF& canvasRect, qreal dpr) const
+{
+    QSize size = (canvasRect.size() * dpr).toSize();
+
+    bool reuse = valid && image.size() == size && image.devicePixelRatio() == dpr &&
+        list == lastCurves && canvasRect == lastRect &&
+        sameMap(xMap, lastXMap) && sameMap(yMap, lastYMap) && xMap.p1() < xMap.p2();
+
+    // already up to date
+    if (reuse && !pendingShift) return;
+
+    // pixels to scroll
+    double dx = residual;
+    if (reuse && !list.isEmpty())
+    {
+        double sw = sampleWidth(list, xMap);
+        dx += pendingShift * sw;
+        // not worth scrolling
+        if (sw <= 0 || dx >= canvasRect.width() / 2) reuse = false;
+    }
+
+    if (!reuse)
+    {
+        if (image.size() != size)
+        {
+            image = QImage(size, QImage::Format_ARGB32_Premultiplied);
+        }
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QPainter p(&image);
+        p.translate(-canvasRect.topLeft());
+        drawCurves(&p, list, xMap, yMap, canvasRect,
+                   canvasRect.left(), canvasRect.right());
+        residual = 0;
+    }
+    else
+    {
+        // scroll whole device pixels, remaining fraction is carried to next draw
+        int dxDev = floor(dx * dpr);
+        residual = dx - dxDev / dpr;
+        scrollImage(dxDev);
+
+        // exposed strip and a margin for line ends are re-drawn from data
+        double penWidth = 1;
+        for (auto curve : list)
+        {
+            penWidth = std::max(penWidth, curve->pen().widthF());
+        }
+        double stripWidth = dxDev / dpr + ceil(penWidth) + 2;
+        QRectF strip(canvasRect.right() - stripWidth, canvasRect.top(),
+                     stripWidth, canvasRect.height());
+
+        QPainter p(&image);
+        p.translate(-canvasRect.topLeft());
+        p.setCompositionMode(QPainter::CompositionMode_Clear);
+        p.fillRect(strip, Qt::transparent);
+        p.setCompositionMode(QPainter::CompositionMode_SourceOver);
+        p.setClipRect(strip);
+        drawCurves(&p, list, xMap, yMap, canvasRect, strip.left(), strip.right());
+    }
+
+    valid = true;
+    pendingShift = 0;
+    lastXMap = xMap;
+    lastYMap = yMap;
+    lastRect = canvasRect;
+    lastCurves = list;
+}
+
+void CurveCache::draw(QPainter* painter,
+                      const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                      const QRectF& canvasRect) const
+{
+    auto list = curves();
+    if (list.isEmpty()) return;
+
+    // cache only what's drawn on canvas, not exports
+    auto canvas = qobject_cast<const QwtPlotCanvas*>(plot()->canvas());
+    const QPaintDevice* device = painter->device();
+    if (canvas == nullptr ||
+        (device != canvas && device != canvas->backingStore()))
+    {
+        drawCurves(painter, list, xMap, yMap, canvasRect,
+                   canvasRect.left(), canvasRect.right());
+        return;
+    }
+
+    render(list, xMap, yMap, canvasRect, device->devicePixelRatioF());
+    painter->drawImage(canvasRect.topLeft(), image);
+}
@@ -0,0 +1,102 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef CURVECACHE_H
+#define CURVECACHE_H
+
+#include <QList>
+#include <QImage>
+#include <qwt_plot_item.h>
+#include <qwt_scale_map.h>
+
+#include "framebuffercurve.h"
+
+/**
+ * Paints the `FrameBufferCurve`s of a plot from a cached image and
+ * updates it incrementally while data scrolls.
+ *
+ * When buffer contents move to the left by `shift()` samples, cached
+ * image is scrolled by the corresponding number of pixels and only
+ * the exposed strip at the right side is drawn from data. Any change
+ * of scale maps, canvas size or set of curves causes a full redraw
+ * as does `invalidate()`.
+ *
+ * Image can be brought up to date with `render()` before the plot is
+ * painted, possibly from a worker thread. Otherwise it's updated when
+ * drawn.
+ *
+ * Curves are only cached when drawn on the plot canvas. Other
+ * targets (ex. SVG export) are drawn directly.
+ */
+class CurveCache : public QwtPlotItem
+{
+public:
+    enum {Rtti_CurveCache = QwtPlotItem::Rtti_PlotUserItem + 1};
+
+    CurveCache();
+
+    int rtti() const override;
+
+    /// Buffer contents moved left by this number of samples since last draw
+    void shift(unsigned numSamples);
+    /// Next draw renders all curves from scratch
+    void invalidate();
+
+    /// Returns visible curves that this item paints
+    QList<const FrameBufferCurve*> curves() const;
+
+    /**
+     * Updates the cached image for given maps and canvas. Doesn't
+     * touch any widgets, can be called from another thread as long
+     * as curves and their data aren't modified meanwhile.
+     *
+     * @note Curves with symbols shouldn't be rendered outside GUI
+     * thread, `QwtSymbol` may use a `QPixmap` cache.
+     */
+    void render(const QList<const FrameBufferCurve*>& list,
+                const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                const QRectF& canvasRect, qreal dpr) const;
+
+    void draw(QPainter* painter,
+              const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+              const QRectF& canvasRect) const override;
+
+private:
+    mutable QImage image;
+    mutable bool valid;
+    mutable quint64 pendingShift;   ///< in samples
+    mutable double residual;        ///< fraction of a pixel not scrolled yet
+    mutable QwtScaleMap lastXMap;
+    mutable QwtScaleMap lastYMap;
+    mutable QRectF lastRect;
+    mutable QList<const FrameBufferCurve*> lastCurves;
+
+    /// Draws the parts of curves between pixel positions `left` and `right`
+    void drawCurves(QPainter* painter, const QList<const FrameBufferCurve*>& list,
+                    const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                    const QRectF& canvasRect, double left, double right) const;
+    /// Returns the pixel distance between consecutive samples
+    double sampleWidth(const QList<const FrameBufferCurve*>& list,
+                       const QwtScaleMap& xMap) const;
+    /// Moves image content to the left, exposed part is left as is
+    void scrollImage(int dx) const;
+};
+
+#endif // CURVECACHE_H
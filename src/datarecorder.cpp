@@ -24,29 +24,91 @@
 #include <QDateTime>
 #include <QtDebug>
 
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 DataRecorder::DataRecorder(QObject *parent) :
-    QObject(parent),
-    fileStream(&file)
+    QObject(parent)
 {
     lastNumChannels = 0;
     disableBuffering = false;
     windowsLE = false;
     timestampOpt = TimestampOption::disabled;
-
-    fileStream.setRealNumberNotation(QTextStream::FixedNotation);
+    _format = Format::csv;
+    compression = false;
+    out = nullptr;
+    syncInterval = 0;
+    syncBytes = 0;
+    syncPos = 0;
+    unsynced = false;
 }
 
 void DataRecorder::setDecimals(unsigned decimals)
 {
-    fileStream.setRealNumberPrecision(decimals);
+    csv.setDecimals(decimals);
+}
+
+void DataRecorder::setDecimation(Decimator::Mode mode, unsigned factor)
+{
+    Q_ASSERT(out == nullptr);
+    decimator.setMode(factor > 1 ? mode : Decimator::None, factor);
+}
+
+void DataRecorder::setSyncPolicy(unsigned intervalMs, qint64 bytes)
+{
+    syncInterval = intervalMs;
+    syncBytes = bytes;
+}
+
+void DataRecorder::syncIfDue()
+{
+    if (out != nullptr && unsynced && syncInterval &&
+        syncTimer.elapsed() >= syncInterval)
+    {
+        sync();
+    }
+}
+
+void DataRecorder::setFormat(Format format)
+{
+    Q_ASSERT(out == nullptr);
+    _format = format;
+}
+
+void DataRecorder::setTimeSource(std::function<qint64()> source)
+{
+    Q_ASSERT(out == nullptr);
+    timeSource = source;
+}
+
+void DataRecorder::setCompression(bool enabled)
+{
+    Q_ASSERT(out == nullptr);
+    compression = enabled;
+}
+
+qint64 DataRecorder::compressedBytes() const
+{
+    return compressedFile.compressedBytes();
+}
+
+qint64 DataRecorder::uncompressedBytes() const
+{
+    return compressedFile.uncompressedBytes();
 }
 
 bool DataRecorder::startRecording(QString fileName, QString separator,
                                   QStringList channelNames, TimestampOption ts)
 {
-    Q_ASSERT(!file.isOpen());
+    Q_ASSERT(out == nullptr);
     _sep =  separator;
     timestampOpt = ts;
+    decimator.reset();
+    csv.setSeparator(_sep);
+    csv.setLineEnding(le());
 
     // create directory if it doesn't exist
     {
@@ -58,68 +120,189 @@ bool DataRecorder::startRecording(QString fileName, QString separator,
         }
     }
 
+    if (_format != Format::csv && channelNames.isEmpty())
+    {
+        qCritical() << "Channel names are required for binary recording";
+        return false;
+    }
+
     // open file
-    file.setFileName(fileName);
-    if (!file.open(QIODevice::WriteOnly))
+    QIODevice* device;
+    if (compression && _format == Format::csv)
+    {
+        compressedFile.setFileName(fileName);
+        device = &compressedFile;
+    }
+    else
+    {
+        file.setFileName(fileName);
+        device = &file;
+    }
+    if (!device->open(QIODevice::WriteOnly))
     {
         qCritical() << "Opening file " << fileName
-                    << " for recording failed with error: " << file.error();
+                    << " for recording failed with error: " << device->errorString();
         return false;
     }
 
     // write header line
     if (!channelNames.isEmpty())
     {
-        if (timestampOpt != TimestampOption::disabled)
+        QString header;
+        if (timestampOpt != TimestampOption::disabled && _format == Format::csv)
         {
-            fileStream << tr("timestamp") << _sep;
+            header = tr("timestamp") + _sep;
         }
-        fileStream << channelNames.join(_sep);
-        fileStream << le();
         lastNumChannels = channelNames.length();
+        if (decimator.mode() == Decimator::MinMeanMax)
+        {
+            QStringList names;
+            for (auto& name : channelNames)
+            {
+                names << name + tr(" (min)") << name + tr(" (mean)") << name + tr(" (max)");
+            }
+            channelNames = names;
+        }
+        if (_format != Format::csv)
+        {
+            auto type = _format == Format::binary32 ?
+                BinaryRecording::SampleType::Float32 : BinaryRecording::SampleType::Float64;
+            if (!binaryWriter.start(device, channelNames, type))
+            {
+                device->close();
+                return false;
+            }
+        }
+        else
+        {
+            header += channelNames.join(_sep) + le();
+            device->write(header.toUtf8());
+        }
     }
+
+    out = device;
+    syncPos = 0;
+    unsynced = false;
+    syncTimer.start();
     return true;
 }
 
 void DataRecorder::feedIn(const SamplePack& data)
 {
-    Q_ASSERT(file.isOpen());    // recorder should be disconnected before stopping recording
+    Q_ASSERT(out != nullptr);   // recorder should be disconnected before stopping recording
     Q_ASSERT(!data.hasX());     // NYI
 
     // check if number of channels has changed during recording and warn
     unsigned numChannels = data.numChannels();
     if (lastNumChannels != 0 && numChannels != lastNumChannels)
     {
-        qWarning() << "Number of channels changed from " << lastNumChannels
-                   << " to " << numChannels <<
-            " during recording, CSV file is corrupted but no data will be lost.";
+        if (_format == Format::csv)
+        {
+            qWarning() << "Number of channels changed from " << lastNumChannels
+                       << " to " << numChannels <<
+                " during recording, CSV file is corrupted but no data will be lost.";
+        }
+        else
+        {
+            qWarning() << "Number of channels changed from " << lastNumChannels
+                       << " to " << numChannels <<
+                " during recording, data is dropped until it's restored.";
+        }
     }
     lastNumChannels = numChannels;
 
-    // write data
+    // decimate before formatting
     unsigned numSamples = data.numSamples();
-    for (unsigned int i = 0; i < numSamples; i++)
+    columns.clear();
+    if (decimator.mode() == Decimator::None)
     {
-        if (timestampOpt != TimestampOption::disabled)
+        for (unsigned ci = 0; ci < numChannels; ci++)
         {
-            fileStream << formatTimestamp() << _sep;
+            columns.push_back(data.data(ci));
         }
-        for (unsigned ci = 0; ci < numChannels; ci++)
+    }
+    else
+    {
+        numSamples = decimator.process(data);
+        for (unsigned ci = 0; ci < decimator.numOutputChannels(numChannels); ci++)
         {
-            fileStream << data.data(ci)[i];
-            if (ci != numChannels-1) fileStream << _sep;
+            columns.push_back(decimator.data(ci));
         }
-        fileStream << le();
     }
 
-    if (disableBuffering) fileStream.flush();
+    if (_format != Format::csv)
+    {
+        if (columns.size() != binaryWriter.numColumns()) return;
+        binaryWriter.addSamples(columns.data(), numSamples);
+        flushIfNeeded();
+        return;
+    }
+
+    // format all rows then write at once, rows of a pack share the timestamp
+    QByteArray prefix;
+    if (timestampOpt != TimestampOption::disabled)
+    {
+        prefix = (formatTimestamp() + _sep).toUtf8();
+    }
+    csv.clear();
+    csv.appendRows(columns.data(), columns.size(), numSamples, prefix);
+    out->write(csv.data(), csv.size());
+
+    flushIfNeeded();
+}
+
+void DataRecorder::flushIfNeeded()
+{
+    unsynced = true;
+    if ((syncInterval && syncTimer.elapsed() >= syncInterval) ||
+        (syncBytes && out->pos() - syncPos >= syncBytes))
+    {
+        sync();
+    }
+    else if (disableBuffering)
+    {
+        flushFile();
+    }
+}
+
+void DataRecorder::flushFile()
+{
+    if (_format != Format::csv) binaryWriter.flush();
+    if (out == &compressedFile)
+    {
+        compressedFile.flush();
+    }
+    else
+    {
+        file.flush();
+    }
+}
+
+void DataRecorder::sync()
+{
+    // unlike `flushFile()` partially filled chunk is always written
+    if (_format != Format::csv) binaryWriter.flush(true);
+    flushFile();
+
+    int handle = out == &compressedFile ? compressedFile.handle() : file.handle();
+#ifdef Q_OS_WIN
+    _commit(handle);
+#else
+    fsync(handle);
+#endif
+
+    syncPos = out->pos();
+    unsynced = false;
+    syncTimer.restart();
 }
 
 void DataRecorder::stopRecording()
 {
-    Q_ASSERT(file.isOpen());
+    Q_ASSERT(out != nullptr);
 
-    file.close();
+    if (_format != Format::csv) binaryWriter.finish();
+    out->close();
+    out = nullptr;
     lastNumChannels = 0;
 }
 
@@ -127,19 +310,18 @@ QString DataRecorder::formatTimestamp() const
 {
     Q_ASSERT(timestampOpt != TimestampOption::disabled);
 
-    qint64 ms;
+    qint64 ms = timeSource ? timeSource() : QDateTime::currentMSecsSinceEpoch();
 
     switch (timestampOpt)
     {
         case TimestampOption::seconds:
-            return QString::number(QDateTime::currentSecsSinceEpoch());
+            return QString::number(ms / 1000);
             break;
         case TimestampOption::seconds_precision:
-            ms = QDateTime::currentMSecsSinceEpoch();
             return QString("%1.%2").arg(ms / 1000).arg(ms % 1000);
             break;
         case TimestampOption::milliseconds:
-            return QString::number(QDateTime::currentMSecsSinceEpoch());
+            return QString::number(ms);
             break;
         default:
             Q_ASSERT(false);
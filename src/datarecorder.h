@@ -22,9 +22,15 @@
 
 #include <QObject>
 #include <QFile>
-#include <QTextStream>
+#include <QElapsedTimer>
+#include <functional>
+#include <vector>
 
 #include "sink.h"
+#include "decimator.h"
+#include "binaryrecording.h"
+#include "csvformatter.h"
+#include "compressedfile.h"
 
 /**
  * Implemented as a `Sink` that writes incoming data to a file. Before
@@ -41,11 +47,42 @@ public:
         disabled, seconds, seconds_precision, milliseconds
     };
 
+    enum class Format
+    {
+        csv,
+        binary32,   ///< binary recording with 32 bit float samples
+        binary64    ///< binary recording with 64 bit float samples
+    };
+
     explicit DataRecorder(QObject *parent = 0);
 
-    /// Disables file buffering
+    /**
+     * Disables file buffering, file is flushed after every write. In
+     * binary formats samples are written once enough are collected
+     * for a reasonably sized chunk.
+     *
+     * @note Shouldn't be changed during a recording.
+     */
     bool disableBuffering;
 
+    /**
+     * Sets when written data is synced to disk. Data is synced when
+     * `intervalMs` milliseconds has passed or `bytes` bytes are
+     * written since the last sync. 0 disables a condition. Both are
+     * disabled by default.
+     *
+     * Conditions are checked when data is written. If data stops,
+     * `syncIfDue()` should be called periodically so that the last
+     * written data is synced as well.
+     */
+    void setSyncPolicy(unsigned intervalMs, qint64 bytes);
+
+    /**
+     * Syncs if sync interval has passed and there is unsynced
+     * data. Should be called from the thread that feeds the recorder.
+     */
+    void syncIfDue();
+
     /**
      * Use CR+LF as line ending. `false` by default.
      *
@@ -56,18 +93,67 @@ public:
 
     /**
      * Set floating point number precision.
+     *
+     * @note Should be called before `startRecording`.
      */
     void setDecimals(unsigned decimals);
 
     /**
-     * @brief Starts recording data to a file in CSV format.
+     * Set decimation of recorded data. Decimation is applied before
+     * formatting. In `MinMeanMax` mode 3 columns are written for each
+     * channel.
+     *
+     * @note Should be called before `startRecording`.
+     */
+    void setDecimation(Decimator::Mode mode, unsigned factor);
+
+    /**
+     * Set file format. In binary formats separator, decimals, line
+     * ending and timestamp options are ignored. See `binaryrecording.h`
+     * for details of the binary format.
+     *
+     * @note Should be called before `startRecording`.
+     */
+    void setFormat(Format format);
+
+    /**
+     * Sets the function that returns the time of the pack being
+     * written (ms since epoch), used for CSV timestamps. Current time
+     * is used if it's empty (default). When fed from a worker thread
+     * this should return the arrival time of the pack, see
+     * `AsyncSink::packTime()`.
+     *
+     * @note Should be called before `startRecording`.
+     */
+    void setTimeSource(std::function<qint64()> source);
+
+    /**
+     * Enables writing through a block compressor, see
+     * `CompressedFile`. Only applies to CSV format, binary
+     * recordings are always written uncompressed so that they can be
+     * memory mapped. With `disableBuffering` every write produces a
+     * small block which hurts compression ratio.
+     *
+     * @note Should be called before `startRecording`.
+     */
+    void setCompression(bool enabled);
+
+    /// Number of bytes written to the compressed file. Can be called
+    /// from any thread.
+    qint64 compressedBytes() const;
+    /// Number of bytes compressed so far. Can be called from any thread.
+    qint64 uncompressedBytes() const;
+
+    /**
+     * @brief Starts recording data to a file in selected format.
      *
      * File is opened and header line (names of channels) is written. After
      * calling this function recorder should be connected to a `Source`.
      *
      * @param fileName name of the recording file
      * @param separator column separator
-     * @param channelNames names of the channels for header line, if empty no header line is written
+     * @param channelNames names of the channels for header line, if
+     * empty no header line is written. Required for binary formats.
      * @param insertTime enable inserting timestamp
      * @return false if file operation fails (read only etc.)
      */
@@ -102,11 +188,35 @@ protected:
 private:
     unsigned lastNumChannels;   ///< used for error message only
     QFile file;
-    QTextStream fileStream;
+    CompressedFile compressedFile;
+    bool compression;
+    /// Either `file` or `compressedFile`, null when not recording
+    QIODevice* out;
+    CsvFormatter csv;
+    Format _format;
+    BinaryRecordingWriter binaryWriter;
     QString _sep;
     TimestampOption timestampOpt;
-
-    /// Returns formatted timestamp
+    Decimator decimator;
+    std::vector<const double*> columns; ///< data of columns to be written
+
+    unsigned syncInterval;     ///< ms, 0 is disabled
+    qint64 syncBytes;          ///< 0 is disabled
+    QElapsedTimer syncTimer;   ///< time since last sync
+    qint64 syncPos;            ///< file position at last sync
+    bool unsynced;             ///< data is written since last sync
+
+    /// Flushes or syncs file according to settings
+    void flushIfNeeded();
+    /// Writes buffered data to the file. Small partial chunks of
+    /// binary formats are kept, see `BinaryRecordingWriter::flush()`.
+    void flushFile();
+    /// Writes buffered data to the disk
+    void sync();
+
+    std::function<qint64()> timeSource;
+
+    /// Returns formatted timestamp of the pack being written
     QString formatTimestamp() const;
 
     /// Returns the selected line ending.
@@ -60,14 +60,21 @@ DataTextView::DataTextView(Stream* stream, QWidget *parent) :
                 }
             });
 
-    ui->textView->setMaximumBlockCount(ui->spNumLines->value());
+    ui->textView->setMaxRows(ui->spNumLines->value());
     connect(ui->spNumLines, &QSpinBox::valueChanged,
             [this](int value)
             {
-                ui->textView->setMaximumBlockCount(value);
+                ui->textView->setMaxRows(value);
             });
 
-    connect(ui->pbClear, &QPushButton::clicked, ui->textView, &QPlainTextEdit::clear);
+    ui->textView->setDecimals(ui->spDecimals->value());
+    connect(ui->spDecimals, &QSpinBox::valueChanged,
+            [this](int value)
+            {
+                ui->textView->setDecimals(value);
+            });
+
+    connect(ui->pbClear, &QPushButton::clicked, ui->textView, &TextRowView::clear);
 }
 
 DataTextView::~DataTextView()
@@ -78,16 +85,7 @@ DataTextView::~DataTextView()
 
 void DataTextView::addData(const SamplePack& data)
 {
-    for (unsigned int i = 0; i < data.numSamples(); i++)
-    {
-        QString str;
-        for (unsigned ci = 0; ci < data.numChannels(); ci++)
-        {
-            str += QString::number(data.data(ci)[i], 'f', ui->spDecimals->value());
-            if (ci != data.numChannels()-1) str += " ";
-        }
-        ui->textView->appendPlainText(str);
-    }
+    ui->textView->addRows(data);
 }
 
 void DataTextView::saveSettings(QSettings* settings)
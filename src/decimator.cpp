@@ -0,0 +1,181 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <QtGlobal>
+
+#include "decimator.h"
+
+Decimator::Decimator()
+{
+    _mode = None;
+    _factor = 1;
+    numChannels = 0;
+    count = 0;
+    outStride = 0;
+}
+
+void Decimator::setMode(Mode mode, unsigned factor)
+{
+    Q_ASSERT(factor > 0);
+
+    _mode = mode;
+    _factor = factor;
+    reset();
+}
+
+Decimator::Mode Decimator::mode() const
+{
+    return _mode;
+}
+
+unsigned Decimator::factor() const
+{
+    return _factor;
+}
+
+void Decimator::reset()
+{
+    count = 0;
+}
+
+unsigned Decimator::numOutputChannels(unsigned numInputChannels) const
+{
+    return _mode == MinMeanMax ? numInputChannels * 3 : numInputChannels;
+}
+
+void Decimator::setNumChannels(unsigned nc)
+{
+    numChannels = nc;
+    sum.assign(nc, 0);
+    min.assign(nc, 0);
+    max.assign(nc, 0);
+    count = 0;
+}
+
+unsigned Decimator::process(const SamplePack& pack)
+{
+    Q_ASSERT(_mode != None);
+
+    if (pack.numChannels() != numChannels)
+    {
+        setNumChannels(pack.numChannels());
+    }
+
+    const unsigned ns = pack.numSamples();
+    const unsigned N = _factor;
+
+    // index of the first sample that starts a new block
+    const unsigned first = (N - count) % N;
+    unsigned numOut;
+    if (_mode == KeepNth)
+    {
+        numOut = first < ns ? (ns - first - 1) / N + 1 : 0;
+    }
+    else                        // number of blocks completed with this pack
+    {
+        numOut = (count + ns) / N;
+    }
+    outStride = numOut;
+    out.resize(numOutputChannels(numChannels) * numOut);
+
+    unsigned endCount = 0;
+    for (unsigned ci = 0; ci < numChannels; ci++)
+    {
+        const double* in = pack.data(ci);
+        unsigned c = count;
+        unsigned o = 0;
+        unsigned i = 0;
+
+        if (_mode == KeepNth)
+        {
+            double* dst = out.data() + ci * numOut;
+            for (i = first; i < ns; i += N)
+            {
+                dst[o++] = in[i];
+            }
+            endCount = (c + ns) % N;
+            continue;
+        }
+
+        double s = sum[ci];
+        double mn = min[ci];
+        double mx = max[ci];
+        double* dstMean;
+        double* dstMin = nullptr;
+        double* dstMax = nullptr;
+        if (_mode == MinMeanMax)
+        {
+            dstMin = out.data() + (ci * 3) * numOut;
+            dstMean = out.data() + (ci * 3 + 1) * numOut;
+            dstMax = out.data() + (ci * 3 + 2) * numOut;
+        }
+        else
+        {
+            dstMean = out.data() + ci * numOut;
+        }
+
+        while (i < ns)
+        {
+            if (c == 0)
+            {
+                s = 0;
+                mn = mx = in[i];
+            }
+
+            // rest of the block that is in this pack
+            unsigned end = std::min(ns, i + (N - c));
+            for (unsigned j = i; j < end; j++)
+            {
+                s += in[j];
+                mn = std::min(mn, in[j]);
+                mx = std::max(mx, in[j]);
+            }
+            c += end - i;
+            i = end;
+
+            if (c == N)
+            {
+                dstMean[o] = s / N;
+                if (dstMin != nullptr)
+                {
+                    dstMin[o] = mn;
+                    dstMax[o] = mx;
+                }
+                o++;
+                c = 0;
+            }
+        }
+
+        sum[ci] = s;
+        min[ci] = mn;
+        max[ci] = mx;
+        endCount = c;
+    }
+
+    count = numChannels ? endCount : count;
+    return numOut;
+}
+
+const double* Decimator::data(unsigned channel) const
+{
+    Q_ASSERT(channel < numOutputChannels(numChannels));
+    return out.data() + channel * outStride;
+}
@@ -0,0 +1,86 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+
+#include <vector>
+
+#include "samplepack.h"
+
+/**
+ * Reduces sample rate of all channels of incoming `SamplePack`s by a
+ * fixed factor. Blocks are kept across packs so that output doesn't
+ * depend on how the data is split into packs.
+ *
+ * In `MinMeanMax` mode each input channel results in 3 output
+ * channels (minimum, mean and maximum of the block, in that order).
+ */
+class Decimator
+{
+public:
+    enum Mode
+    {
+        None = 0,               ///< pass through
+        KeepNth,                ///< keep first sample of each block
+        Average,                ///< mean of the block
+        MinMeanMax              ///< minimum, mean and maximum of the block
+    };
+
+    Decimator();
+
+    /// Sets decimation mode and block size, state is reset
+    void setMode(Mode mode, unsigned factor);
+    Mode mode() const;
+    unsigned factor() const;
+
+    /// Drops the partially collected block
+    void reset();
+
+    /// Returns number of output channels for given number of input channels
+    unsigned numOutputChannels(unsigned numInputChannels) const;
+
+    /**
+     * Processes a pack and returns the number of output samples. Output
+     * is accessed with `data()` and is valid until the next call.
+     *
+     * @note Should not be called in `None` mode.
+     */
+    unsigned process(const SamplePack& pack);
+
+    /// Returns output samples of an output channel
+    const double* data(unsigned channel) const;
+
+private:
+    Mode _mode;
+    unsigned _factor;
+    unsigned numChannels;       ///< number of input channels
+    unsigned count;             ///< number of samples in the current block
+    std::vector<double> sum;    ///< per channel, for current block
+    std::vector<double> min;
+    std::vector<double> max;
+    std::vector<double> out;    ///< output, channel by channel
+    unsigned outStride;         ///< distance between output channels in `out`
+
+    /// Resizes per channel state for given number of channels
+    void setNumChannels(unsigned nc);
+};
+
+#endif // DECIMATOR_H
@@ -0,0 +1,101 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <math.h>
+#include <algorithm>
+#include <QPainter>
+
+#include "densityitem.h"
+
+DensityItem::DensityItem()
+{
+    _rect = QRectF(0, 0, 1, 1);
+    setZ(10);
+    fillColorTable(colorTable);
+}
+
+int DensityItem::rtti() const
+{
+    return Rtti_Density;
+}
+
+void DensityItem::setDensity(const std::vector<quint32>& data,
+                             unsigned width, unsigned height)
+{
+    Q_ASSERT(data.size() == (size_t) width * height);
+
+    if (image.width() != (int) width || image.height() != (int) height)
+    {
+        image = QImage(width, height, QImage::Format_ARGB32_Premultiplied);
+    }
+    if (image.isNull()) return;
+
+    quint32 maxCount = data.empty() ? 0 : *std::max_element(data.begin(), data.end());
+    if (maxCount == 0)
+    {
+        image.fill(Qt::transparent);
+        return;
+    }
+
+    // most visited cells get the last color
+    const double k = (COLOR_TABLE_SIZE - 1) / log(1. + maxCount);
+    for (unsigned y = 0; y < height; y++)
+    {
+        auto line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        unsigned row = height - 1 - y;  // image is top to bottom
+        for (unsigned x = 0; x < width; x++)
+        {
+            quint32 c = data[(size_t) x * height + row];
+            line[x] = c ? colorTable[int(log(1. + c) * k)] : 0;
+        }
+    }
+    itemChanged();
+}
+
+void DensityItem::setRect(const QRectF& rect)
+{
+    _rect = rect;
+    itemChanged();
+}
+
+void DensityItem::clear()
+{
+    image.fill(Qt::transparent);
+    itemChanged();
+}
+
+QRectF DensityItem::boundingRect() const
+{
+    return _rect;
+}
+
+void DensityItem::draw(QPainter* painter,
+                       const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                       const QRectF& canvasRect) const
+{
+    Q_UNUSED(canvasRect);
+
+    if (image.isNull()) return;
+
+    QRectF target(QPointF(xMap.transform(_rect.left()), yMap.transform(_rect.bottom())),
+                  QPointF(xMap.transform(_rect.right()), yMap.transform(_rect.top())));
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, false);
+    painter->drawImage(target.normalized(), image);
+}
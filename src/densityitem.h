@@ -0,0 +1,64 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DENSITYITEM_H
+#define DENSITYITEM_H
+
+#include <vector>
+#include <QImage>
+#include <qwt_plot_item.h>
+#include <qwt_scale_map.h>
+
+#include "colormap.h"
+
+/**
+ * Displays a 2D hit count histogram as an image, with logarithmic
+ * intensity through a color map. Cells without hits are transparent.
+ */
+class DensityItem : public QwtPlotItem
+{
+public:
+    enum {Rtti_Density = QwtPlotItem::Rtti_PlotUserItem + 4};
+
+    DensityItem();
+
+    int rtti() const override;
+
+    /**
+     * Sets the histogram, `data` is column major with bottom row
+     * first. Image is colored here, not when drawn.
+     */
+    void setDensity(const std::vector<quint32>& data, unsigned width, unsigned height);
+    /// Sets the plot area that histogram covers
+    void setRect(const QRectF& rect);
+    void clear();
+
+    QRectF boundingRect() const override;
+    void draw(QPainter* painter,
+              const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+              const QRectF& canvasRect) const override;
+
+private:
+    QImage image;
+    QRectF _rect;
+    QRgb colorTable[COLOR_TABLE_SIZE];
+};
+
+#endif // DENSITYITEM_H
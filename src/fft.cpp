@@ -0,0 +1,161 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <QtGlobal>
+
+#include "fft.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+bool RealFFT::isPowerOf2(unsigned n)
+{
+    return n && !(n & (n - 1));
+}
+
+RealFFT::RealFFT(unsigned n) :
+    n(n), half(n / 2)
+{
+    Q_ASSERT(isPowerOf2(n) && n >= 4);
+
+    unsigned bits = 0;
+    while ((1u << bits) < half) bits++;
+
+    bitrev.resize(half);
+    for (unsigned i = 0; i < half; i++)
+    {
+        unsigned r = 0;
+        for (unsigned b = 0; b < bits; b++)
+        {
+            if (i & (1u << b)) r |= 1u << (bits - 1 - b);
+        }
+        bitrev[i] = r;
+    }
+
+    // twiddles of each stage are stored consecutively for cache friendly access
+    twRe.resize(half);
+    twIm.resize(half);
+    for (unsigned hs = 1; hs < half; hs *= 2)
+    {
+        for (unsigned j = 0; j < hs; j++)
+        {
+            twRe[hs + j] = cos(M_PI * j / hs);
+            twIm[hs + j] = -sin(M_PI * j / hs);
+        }
+    }
+
+    postRe.resize(half);
+    postIm.resize(half);
+    for (unsigned k = 0; k < half; k++)
+    {
+        postRe[k] = cos(2 * M_PI * k / n);
+        postIm[k] = -sin(2 * M_PI * k / n);
+    }
+
+    bufRe.resize(half);
+    bufIm.resize(half);
+    outRe.resize(half + 1);
+    outIm.resize(half + 1);
+}
+
+unsigned RealFFT::size() const
+{
+    return n;
+}
+
+void RealFFT::complexFFT()
+{
+    double* re = bufRe.data();
+    double* im = bufIm.data();
+
+    for (unsigned size = 2; size <= half; size *= 2)
+    {
+        unsigned hs = size / 2;
+        const double* wRe = &twRe[hs];
+        const double* wIm = &twIm[hs];
+        for (unsigned start = 0; start < half; start += size)
+        {
+            for (unsigned j = 0; j < hs; j++)
+            {
+                double wr = wRe[j];
+                double wi = wIm[j];
+                unsigned a = start + j;
+                unsigned b = a + hs;
+                double tr = re[b] * wr - im[b] * wi;
+                double ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
+
+void RealFFT::transform(const double* in, double* re, double* im)
+{
+    // pack even samples to real, odd samples to imaginary part, in bit reversed order
+    for (unsigned i = 0; i < half; i++)
+    {
+        unsigned r = bitrev[i];
+        bufRe[r] = in[2 * i];
+        bufIm[r] = in[2 * i + 1];
+    }
+
+    complexFFT();
+
+    // separate even and odd spectrums and combine
+    for (unsigned k = 0; k <= half; k++)
+    {
+        unsigned k1 = k % half;
+        unsigned k2 = (half - k) % half;
+        double zr = bufRe[k1], zi = bufIm[k1];
+        double cr = bufRe[k2], ci = -bufIm[k2]; // conjugate
+
+        double er = (zr + cr) / 2, ei = (zi + ci) / 2;
+        // (Z - conj)/(2i)
+        double orr = (zi - ci) / 2, oi = -(zr - cr) / 2;
+
+        double wr, wi;
+        if (k < half)
+        {
+            wr = postRe[k];
+            wi = postIm[k];
+        }
+        else
+        {
+            wr = -1;
+            wi = 0;
+        }
+
+        re[k] = er + orr * wr - oi * wi;
+        im[k] = ei + orr * wi + oi * wr;
+    }
+}
+
+void RealFFT::powerSpectrum(const double* in, double* out)
+{
+    transform(in, outRe.data(), outIm.data());
+    for (unsigned k = 0; k <= half; k++)
+    {
+        out[k] = outRe[k] * outRe[k] + outIm[k] * outIm[k];
+    }
+}
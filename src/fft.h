@@ -0,0 +1,68 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <vector>
+
+/**
+ * Real input FFT for power of 2 sizes.
+ *
+ * A real signal of size N is transformed with a complex radix-2 FFT of
+ * size N/2 and a post processing step. Twiddle factors and bit
+ * reversal table are calculated once at construction, `transform()`
+ * doesn't allocate.
+ */
+class RealFFT
+{
+public:
+    /// @param n FFT size, must be a power of 2 and at least 4
+    explicit RealFFT(unsigned n);
+
+    unsigned size() const;
+
+    /**
+     * Transforms `n` real samples. Outputs `n/2+1` complex bins from
+     * DC to nyquist.
+     *
+     * @note not thread safe, uses internal buffers
+     */
+    void transform(const double* in, double* re, double* im);
+
+    /// Calculates `|X[k]|^2` for `k` in `[0, n/2]`
+    void powerSpectrum(const double* in, double* out);
+
+    static bool isPowerOf2(unsigned n);
+
+private:
+    unsigned n;
+    unsigned half;
+    std::vector<unsigned> bitrev;       ///< bit reversal table of `half`
+    /// twiddles, exp(-πij/hs) for j < hs are at index `hs + j` for each stage
+    std::vector<double> twRe, twIm;
+    std::vector<double> postRe, postIm; ///< exp(-2πik/n) for k < half
+    std::vector<double> bufRe, bufIm;   ///< work buffers of `half` size
+    std::vector<double> outRe, outIm;   ///< used by `powerSpectrum()`
+
+    /// In place complex FFT of size `half` on work buffers
+    void complexFFT();
+};
+
+#endif // FFT_H
@@ -0,0 +1,304 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <QStringList>
+#include <QtGlobal>
+
+#include "filter.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/// Maximum number of biquad sections
+static const unsigned MAX_SECTIONS = 16;
+/// Maximum number of FIR taps
+static const unsigned MAX_TAPS = 4096;
+
+/// Type names used for serialization, order should match `FilterSpec::Type`
+static const char* typeNames[] = {
+    "none", "lowpass", "highpass", "bandpass", "notch", "firlowpass", "movingaverage"
+};
+
+/// Type names for display, order should match `FilterSpec::Type`
+static const char* typeLabels[] = {
+    "None", "Low Pass", "High Pass", "Band Pass", "Notch", "FIR Low Pass", "Moving Average"
+};
+
+QString FilterSpec::toString() const
+{
+    switch (type)
+    {
+        case None:
+            return typeLabels[None];
+        case MovingAverage:
+            return QString("%1 (%2 taps)").arg(typeLabels[type]).arg(order);
+        case FirLowPass:
+            return QString("%1 %2 Hz (%3 taps)").arg(typeLabels[type]).arg(frequency).arg(order);
+        default:
+            return QString("%1 %2 Hz (x%3)").arg(typeLabels[type]).arg(frequency).arg(order);
+    }
+}
+
+QString FilterSpec::serialize() const
+{
+    return QString("%1,%2,%3,%4,%5")
+        .arg(typeNames[type])
+        .arg(sampleRate, 0, 'g', 17)
+        .arg(frequency, 0, 'g', 17)
+        .arg(q, 0, 'g', 17)
+        .arg(order);
+}
+
+FilterSpec FilterSpec::deserialize(const QString& str)
+{
+    FilterSpec spec;
+    QStringList parts = str.split(',');
+    if (parts.size() != 5) return FilterSpec();
+
+    int type = -1;
+    for (unsigned i = 0; i < sizeof(typeNames) / sizeof(typeNames[0]); i++)
+    {
+        if (parts[0] == typeNames[i]) type = i;
+    }
+
+    bool ok[4];
+    spec.type = (Type) type;
+    spec.sampleRate = parts[1].toDouble(&ok[0]);
+    spec.frequency = parts[2].toDouble(&ok[1]);
+    spec.q = parts[3].toDouble(&ok[2]);
+    spec.order = parts[4].toUInt(&ok[3]);
+
+    if (type < 0 || !(ok[0] && ok[1] && ok[2] && ok[3]) || !spec.isValid())
+    {
+        return FilterSpec();
+    }
+    return spec;
+}
+
+bool FilterSpec::isValid() const
+{
+    switch (type)
+    {
+        case None:
+            return true;
+        case MovingAverage:
+            return order >= 1 && order <= MAX_TAPS;
+        case FirLowPass:
+            return order >= 1 && order <= MAX_TAPS && sampleRate > 0 &&
+                frequency > 0 && frequency < sampleRate / 2;
+        default:
+            return order >= 1 && order <= MAX_SECTIONS && sampleRate > 0 &&
+                frequency > 0 && frequency < sampleRate / 2 && q > 0;
+    }
+}
+
+Filter* Filter::create(const FilterSpec& spec)
+{
+    if (spec.type == FilterSpec::None || !spec.isValid()) return nullptr;
+
+    switch (spec.type)
+    {
+        case FilterSpec::LowPass:
+        case FilterSpec::HighPass:
+        {
+            // Butterworth response of order 2n from n sections
+            std::vector<BiquadFilter::Coeffs> sections;
+            unsigned n = spec.order;
+            for (unsigned k = 0; k < n; k++)
+            {
+                double q = 1. / (2 * cos((2 * k + 1) * M_PI / (4 * n)));
+                sections.push_back(BiquadFilter::design(spec.type, spec.sampleRate,
+                                                        spec.frequency, q));
+            }
+            return new BiquadFilter(sections);
+        }
+        case FilterSpec::BandPass:
+        case FilterSpec::Notch:
+        {
+            auto c = BiquadFilter::design(spec.type, spec.sampleRate, spec.frequency, spec.q);
+            return new BiquadFilter(std::vector<BiquadFilter::Coeffs>(spec.order, c));
+        }
+        case FilterSpec::FirLowPass:
+            return new FirFilter(FirFilter::designLowPass(spec.order, spec.sampleRate,
+                                                          spec.frequency));
+        case FilterSpec::MovingAverage:
+            return new FirFilter(std::vector<double>(spec.order, 1. / spec.order));
+        default:
+            return nullptr;
+    }
+}
+
+BiquadFilter::BiquadFilter(const std::vector<Coeffs>& sections) :
+    sections(sections), states(sections.size())
+{
+    reset();
+}
+
+BiquadFilter::Coeffs BiquadFilter::design(FilterSpec::Type type, double sampleRate,
+                                          double frequency, double q)
+{
+    double w0 = 2 * M_PI * frequency / sampleRate;
+    double cosw = cos(w0);
+    double alpha = sin(w0) / (2 * q);
+
+    double b0, b1, b2;
+    double a0 = 1 + alpha;
+    double a1 = -2 * cosw;
+    double a2 = 1 - alpha;
+
+    switch (type)
+    {
+        case FilterSpec::LowPass:
+            b0 = (1 - cosw) / 2;
+            b1 = 1 - cosw;
+            b2 = (1 - cosw) / 2;
+            break;
+        case FilterSpec::HighPass:
+            b0 = (1 + cosw) / 2;
+            b1 = -(1 + cosw);
+            b2 = (1 + cosw) / 2;
+            break;
+        case FilterSpec::BandPass:
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            break;
+        case FilterSpec::Notch:
+            b0 = 1;
+            b1 = -2 * cosw;
+            b2 = 1;
+            break;
+        default:
+            Q_ASSERT(false);
+            b0 = 1; b1 = 0; b2 = 0; a1 = 0; a2 = 0; a0 = 1;
+    }
+
+    return {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+}
+
+void BiquadFilter::reset()
+{
+    for (auto& s : states)
+    {
+        s = {0, 0};
+    }
+}
+
+void BiquadFilter::process(const double* in, double* out, unsigned n)
+{
+    // process whole block one section at a time
+    const double* src = in;
+    for (unsigned si = 0; si < sections.size(); si++)
+    {
+        const Coeffs c = sections[si];
+        double z1 = states[si].z1;
+        double z2 = states[si].z2;
+
+        for (unsigned i = 0; i < n; i++)
+        {
+            double x = src[i];
+            double y = c.b0 * x + z1;
+            z1 = c.b1 * x - c.a1 * y + z2;
+            z2 = c.b2 * x - c.a2 * y;
+            out[i] = y;
+        }
+
+        states[si] = {z1, z2};
+        src = out;
+    }
+}
+
+FirFilter::FirFilter(const std::vector<double>& taps) :
+    taps(taps)
+{
+    Q_ASSERT(!taps.empty());
+    reset();
+}
+
+std::vector<double> FirFilter::designLowPass(unsigned numTaps, double sampleRate,
+                                             double frequency)
+{
+    std::vector<double> h(numTaps);
+    double fc = frequency / sampleRate;
+    double m = numTaps - 1;
+    double sum = 0;
+
+    for (unsigned k = 0; k < numTaps; k++)
+    {
+        double t = k - m / 2;
+        double sinc = (t == 0) ? 2 * fc : sin(2 * M_PI * fc * t) / (M_PI * t);
+        double window = (numTaps > 1) ? 0.54 - 0.46 * cos(2 * M_PI * k / m) : 1.;
+        h[k] = sinc * window;
+        sum += h[k];
+    }
+
+    for (auto& v : h)
+    {
+        v /= sum;
+    }
+    return h;
+}
+
+void FirFilter::reset()
+{
+    buffer.assign(taps.size() - 1, 0.);
+}
+
+void FirFilter::process(const double* in, double* out, unsigned n)
+{
+    const unsigned hist = taps.size() - 1;
+
+    if (buffer.size() < hist + n)
+    {
+        buffer.resize(hist + n);
+    }
+    // input is copied first so that `in` and `out` can be the same
+    memcpy(&buffer[hist], in, n * sizeof(double));
+
+    /* Loops are ordered so that inner loop runs over consecutive
+     * output samples with a fixed tap, which is vectorizable. Output
+     * is processed in chunks to stay in cache for long filters. */
+    const unsigned CHUNK = 256;
+    for (unsigned start = 0; start < n; start += CHUNK)
+    {
+        unsigned count = std::min(CHUNK, n - start);
+        double* o = out + start;
+        std::fill(o, o + count, 0.);
+
+        for (unsigned k = 0; k <= hist; k++)
+        {
+            const double t = taps[k];
+            const double* x = &buffer[hist + start - k];
+            for (unsigned i = 0; i < count; i++)
+            {
+                o[i] += t * x[i];
+            }
+        }
+    }
+
+    // keep last samples as history for next block
+    if (hist)
+    {
+        memmove(&buffer[0], &buffer[n], hist * sizeof(double));
+    }
+}
@@ -0,0 +1,129 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <vector>
+#include <QString>
+
+/// Describes a filter for a single channel
+struct FilterSpec
+{
+    enum Type
+    {
+        None = 0,
+        LowPass,                ///< Butterworth biquad cascade
+        HighPass,               ///< Butterworth biquad cascade
+        BandPass,               ///< biquad cascade, `q` sets bandwidth
+        Notch,                  ///< biquad cascade, `q` sets bandwidth
+        FirLowPass,             ///< windowed sinc, `order` is number of taps
+        MovingAverage           ///< FIR, `order` is number of taps
+    };
+
+    Type type = None;
+    double sampleRate = 1000;   ///< in Hz
+    double frequency = 50;      ///< cutoff or center frequency in Hz
+    double q = 0.707;
+    /// Number of biquad sections for IIR filters, number of taps for FIR filters
+    unsigned order = 1;
+
+    /// Returns a short human readable description
+    QString toString() const;
+    /// Returns a string representation for storing in settings
+    QString serialize() const;
+    /// Parses a string created with `serialize()`. Returns `None` type filter on error.
+    static FilterSpec deserialize(const QString& str);
+    /// Returns true if spec parameters are usable
+    bool isValid() const;
+};
+
+/// Abstract base class for single channel filters
+class Filter
+{
+public:
+    virtual ~Filter() {};
+
+    /**
+     * Filters a block of samples. State is kept between calls so
+     * consecutive blocks are filtered as a continuous signal.
+     *
+     * @note `in` and `out` can be the same array.
+     */
+    virtual void process(const double* in, double* out, unsigned n) = 0;
+
+    /// Clears the filter state
+    virtual void reset() = 0;
+
+    /// Creates a filter from given spec, returns `nullptr` for `None` or invalid spec
+    static Filter* create(const FilterSpec& spec);
+};
+
+/// Cascade of second order IIR sections in transposed direct form 2
+class BiquadFilter : public Filter
+{
+public:
+    struct Coeffs
+    {
+        double b0, b1, b2, a1, a2; ///< normalized so that a0 = 1
+    };
+
+    BiquadFilter(const std::vector<Coeffs>& sections);
+
+    void process(const double* in, double* out, unsigned n) override;
+    void reset() override;
+
+    /// Designs a single section using "Audio EQ Cookbook" formulas
+    static Coeffs design(FilterSpec::Type type, double sampleRate,
+                         double frequency, double q);
+
+private:
+    struct State
+    {
+        double z1, z2;
+    };
+
+    std::vector<Coeffs> sections;
+    std::vector<State> states;
+};
+
+/// Finite impulse response filter
+class FirFilter : public Filter
+{
+public:
+    FirFilter(const std::vector<double>& taps);
+
+    void process(const double* in, double* out, unsigned n) override;
+    void reset() override;
+
+    /// Returns windowed (Hamming) sinc low pass taps, normalized to unity DC gain
+    static std::vector<double> designLowPass(unsigned numTaps, double sampleRate,
+                                             double frequency);
+
+private:
+    std::vector<double> taps;
+    /**
+     * Last `taps.size()-1` input samples followed by current
+     * block. Only grows, so that there are no allocations in
+     * steady state.
+     */
+    std::vector<double> buffer;
+};
+
+#endif // FILTER_H
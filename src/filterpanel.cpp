@@ -0,0 +1,199 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <QtDebug>
+
+#include "filterpanel.h"
+#include "ui_filterpanel.h"
+
+#include "setting_defines.h"
+
+FilterPanel::FilterPanel(ChannelFilters* filters, QWidget *parent) :
+    QWidget(parent),
+    ui(new Ui::FilterPanel)
+{
+    _filters = filters;
+    ui->setupUi(this);
+
+    connect(_filters, &ChannelFilters::numChannelsChanged,
+            this, &FilterPanel::onNumChannelsChanged);
+    connect(ui->cbChannel, &QComboBox::currentIndexChanged,
+            this, &FilterPanel::onChannelSelected);
+    connect(ui->cbType, &QComboBox::currentIndexChanged,
+            this, &FilterPanel::onTypeChanged);
+    connect(ui->pbApply, &QPushButton::clicked, this, &FilterPanel::onApply);
+    connect(ui->pbApplyAll, &QPushButton::clicked, this, &FilterPanel::onApplyAll);
+    connect(ui->spDecimation, &QSpinBox::valueChanged,
+            [this](int value)
+            {
+                _filters->setDecimation(value);
+            });
+
+    onNumChannelsChanged(_filters->numChannels());
+    onTypeChanged(ui->cbType->currentIndex());
+}
+
+FilterPanel::~FilterPanel()
+{
+    delete ui;
+}
+
+void FilterPanel::onNumChannelsChanged(unsigned value)
+{
+    int current = ui->cbChannel->currentIndex();
+
+    ui->cbChannel->blockSignals(true);
+    ui->cbChannel->clear();
+    for (unsigned ci = 0; ci < value; ci++)
+    {
+        ui->cbChannel->addItem(QString("Channel %1").arg(ci + 1));
+    }
+    ui->cbChannel->setCurrentIndex(std::min(std::max(current, 0), (int) value - 1));
+    ui->cbChannel->blockSignals(false);
+
+    onChannelSelected(ui->cbChannel->currentIndex());
+    updateSummary();
+}
+
+void FilterPanel::onChannelSelected(int index)
+{
+    if (index < 0) return;
+
+    FilterSpec spec = _filters->filter(index);
+    if (spec.type != FilterSpec::None)
+    {
+        showSpec(spec);
+    }
+    else
+    {
+        ui->cbType->setCurrentIndex(FilterSpec::None);
+    }
+}
+
+void FilterPanel::onTypeChanged(int index)
+{
+    auto type = (FilterSpec::Type) index;
+    bool none = type == FilterSpec::None;
+    bool fir = type == FilterSpec::FirLowPass || type == FilterSpec::MovingAverage;
+    bool usesQ = type == FilterSpec::BandPass || type == FilterSpec::Notch;
+
+    ui->spSampleRate->setEnabled(!none && type != FilterSpec::MovingAverage);
+    ui->spFrequency->setEnabled(!none && type != FilterSpec::MovingAverage);
+    ui->spQ->setEnabled(usesQ);
+    ui->spOrder->setEnabled(!none);
+    ui->spOrder->setMaximum(fir ? 4096 : 16);
+}
+
+FilterSpec FilterPanel::editorSpec() const
+{
+    FilterSpec spec;
+    spec.type = (FilterSpec::Type) ui->cbType->currentIndex();
+    spec.sampleRate = ui->spSampleRate->value();
+    spec.frequency = ui->spFrequency->value();
+    spec.q = ui->spQ->value();
+    spec.order = ui->spOrder->value();
+    return spec;
+}
+
+void FilterPanel::showSpec(const FilterSpec& spec)
+{
+    ui->cbType->setCurrentIndex(spec.type);
+    ui->spSampleRate->setValue(spec.sampleRate);
+    ui->spFrequency->setValue(spec.frequency);
+    ui->spQ->setValue(spec.q);
+    ui->spOrder->setValue(spec.order);
+}
+
+bool FilterPanel::applyTo(unsigned channel, const FilterSpec& spec)
+{
+    if (!spec.isValid())
+    {
+        qWarning() << "Invalid filter parameters for channel" << channel + 1
+                   << "(frequency must be below half of the sample rate)";
+        return false;
+    }
+
+    _filters->setFilter(channel, spec);
+    return true;
+}
+
+void FilterPanel::onApply()
+{
+    int channel = ui->cbChannel->currentIndex();
+    if (channel < 0) return;
+
+    applyTo(channel, editorSpec());
+    updateSummary();
+}
+
+void FilterPanel::onApplyAll()
+{
+    auto spec = editorSpec();
+    for (unsigned ci = 0; ci < _filters->numChannels(); ci++)
+    {
+        if (!applyTo(ci, spec)) break;
+    }
+    updateSummary();
+}
+
+void FilterPanel::updateSummary()
+{
+    QStringList lines;
+    for (unsigned ci = 0; ci < _filters->numChannels(); ci++)
+    {
+        auto spec = _filters->filter(ci);
+        if (spec.type != FilterSpec::None)
+        {
+            lines << QString("Channel %1: %2").arg(ci + 1).arg(spec.toString());
+        }
+    }
+    ui->teSummary->setPlainText(lines.join('\n'));
+}
+
+void FilterPanel::saveSettings(QSettings* settings)
+{
+    // stores filters of current channels only
+    QStringList specs;
+    for (unsigned ci = 0; ci < _filters->numChannels(); ci++)
+    {
+        specs << _filters->filter(ci).serialize();
+    }
+
+    settings->beginGroup(SettingGroup_Filter);
+    settings->setValue(SG_Filter_Filters, specs);
+    settings->setValue(SG_Filter_Decimation, ui->spDecimation->value());
+    settings->endGroup();
+}
+
+void FilterPanel::loadSettings(QSettings* settings)
+{
+    settings->beginGroup(SettingGroup_Filter);
+    QStringList specs = settings->value(SG_Filter_Filters).toStringList();
+    for (int ci = 0; ci < specs.size(); ci++)
+    {
+        _filters->setFilter(ci, FilterSpec::deserialize(specs[ci]));
+    }
+    ui->spDecimation->setValue(
+        settings->value(SG_Filter_Decimation, ui->spDecimation->value()).toInt());
+    settings->endGroup();
+
+    onChannelSelected(ui->cbChannel->currentIndex());
+    updateSummary();
+}
@@ -0,0 +1,67 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FILTERPANEL_H
+#define FILTERPANEL_H
+
+#include <QWidget>
+#include <QSettings>
+
+#include "channelfilters.h"
+
+namespace Ui {
+class FilterPanel;
+}
+
+/// Panel for editing channel filters
+class FilterPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit FilterPanel(ChannelFilters* filters, QWidget *parent = 0);
+    ~FilterPanel();
+
+    /// Stores settings into a `QSettings`
+    void saveSettings(QSettings* settings);
+    /// Loads settings from a `QSettings`.
+    void loadSettings(QSettings* settings);
+
+private:
+    Ui::FilterPanel *ui;
+    ChannelFilters* _filters;
+
+    /// Returns the spec entered in the editor
+    FilterSpec editorSpec() const;
+    /// Shows given spec in the editor
+    void showSpec(const FilterSpec& spec);
+    /// Applies spec to given channel, shows a warning if it's invalid
+    bool applyTo(unsigned channel, const FilterSpec& spec);
+    /// Updates list of active filters
+    void updateSummary();
+
+private slots:
+    void onNumChannelsChanged(unsigned value);
+    void onChannelSelected(int index);
+    void onTypeChanged(int index);
+    void onApply();
+    void onApplyAll();
+};
+
+#endif // FILTERPANEL_H
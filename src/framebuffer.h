@@ -40,6 +40,30 @@ public:
     virtual double sample(unsigned i) const = 0;
     /// Returns minimum and maximum of the buffer values.
     virtual Range limits() const = 0;
+    /**
+     * Returns number of valid (actually received) samples. Valid
+     * samples are always at the end of the buffer, in range
+     * `[size()-numValid(), size())`. By default all samples are
+     * valid.
+     */
+    virtual unsigned numValid() const {return size();};
+    /**
+     * Returns minimum and maximum of samples in range `[start,
+     * end)`. Range must not be empty. Default implementation reads
+     * samples one by one, buffers should override it with a faster
+     * one if possible.
+     */
+    virtual Range rangeLimits(unsigned start, unsigned end) const
+    {
+        Range r = {sample(start), sample(start)};
+        for (unsigned i = start + 1; i < end; i++)
+        {
+            double s = sample(i);
+            if (s < r.start) r.start = s;
+            else if (s > r.end) r.end = s;
+        }
+        return r;
+    };
 };
 
 /// Common base class for index and writable frame buffers
@@ -55,9 +79,10 @@ public:
 /// Abstract base class for writable frame buffers
 class WFrameBuffer : public ResizableBuffer
 {
+public:
     /// Add samples to the buffer
     virtual void addSamples(double* samples, unsigned n) = 0;
-    /// Reset all data to 0
+    /// Marks all data as invalid, see `numValid()`
     virtual void clear() = 0;
 };
 
@@ -77,8 +102,54 @@ public:
      * If given value is bigger than max or smaller than minimum
      * returns `OUT_OF_RANGE`. If it's in between values, smaller
      * index is returned (not closer one).
+     *
+     * Default implementation is a binary search, buffers should
+     * override it if they can calculate the index directly.
      */
-    virtual int findIndex(double value) const = 0;
+    virtual int findIndex(double value) const
+    {
+        unsigned n = size();
+        if (n == 0 || value < sample(0) || value > sample(n-1))
+        {
+            return OUT_OF_RANGE;
+        }
+
+        // last index with a sample not bigger than value
+        unsigned lo = 0, hi = n - 1;
+        while (lo < hi)
+        {
+            unsigned mid = lo + (hi - lo + 1) / 2;
+            if (sample(mid) <= value)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+        return lo;
+    };
+
+    /**
+     * Same as `findIndex()`, but checks `hint` and its neighbors
+     * first. Useful when consecutive searches are for close values.
+     */
+    int findIndexNear(double value, int hint) const
+    {
+        int n = size();
+        for (int i = hint - 1; i <= hint + 1; i++)
+        {
+            if (i < 0 || i >= n || sample(i) > value) continue;
+
+            // next sample should be bigger, or value should be the last one
+            if (i < n - 1 ? sample(i+1) > value : value == sample(i))
+            {
+                return i;
+            }
+        }
+        return findIndex(value);
+    };
 };
 
 #endif // FRAMEBUFFER_H
@@ -0,0 +1,140 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <math.h>
+#include <algorithm>
+#include <QPainter>
+
+#include "framebuffercurve.h"
+
+/// Empty space at top and bottom of a lane, as a ratio of lane height
+static const double LANE_MARGIN = 0.05;
+
+FrameBufferCurve::FrameBufferCurve(QString title, const XFrameBuffer* x, const FrameBuffer* y) :
+    QwtPlotCurve(title)
+{
+    _cached = false;
+    inLane = false;
+    setSamples(new FrameBufferSeries(x, y));
+}
+
+FrameBufferSeries* FrameBufferCurve::series()
+{
+    return static_cast<FrameBufferSeries*>(data());
+}
+
+const FrameBufferSeries* FrameBufferCurve::series() const
+{
+    return static_cast<const FrameBufferSeries*>(data());
+}
+
+void FrameBufferCurve::setCached(bool cached)
+{
+    _cached = cached;
+}
+
+bool FrameBufferCurve::isCached() const
+{
+    return _cached;
+}
+
+void FrameBufferCurve::setLane(double bottom, double top,
+                               bool autoScaled, double yMin, double yMax)
+{
+    inLane = true;
+    laneBottom = bottom;
+    laneTop = top;
+    laneAutoScaled = autoScaled;
+    laneMin = yMin;
+    laneMax = yMax;
+}
+
+void FrameBufferCurve::clearLane()
+{
+    inLane = false;
+}
+
+void FrameBufferCurve::draw(QPainter* painter,
+                            const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                            const QRectF& canvasRect) const
+{
+    if (_cached) return;
+    QwtPlotCurve::draw(painter, xMap, yMap, canvasRect);
+}
+
+void FrameBufferCurve::drawSeries(QPainter* painter,
+                                  const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                                  const QRectF& canvasRect, int from, int to) const
+{
+    if (inLane)
+    {
+        // cull lanes that are out of view
+        double y1 = yMap.transform(laneBottom);
+        double y2 = yMap.transform(laneTop);
+        QRectF laneRect(canvasRect.left(), std::min(y1, y2),
+                        canvasRect.width(), fabs(y2 - y1));
+        laneRect = laneRect.intersected(canvasRect);
+        if (laneRect.isEmpty()) return;
+
+        double lmin = laneMin, lmax = laneMax;
+        if (laneAutoScaled)
+        {
+            auto lim = series()->yData()->limits();
+            lmin = lim.start;
+            lmax = lim.end;
+        }
+        if (lmin == lmax)
+        {
+            lmin -= 0.5;
+            lmax += 0.5;
+        }
+
+        // map the lane range to the inner part of the lane
+        double margin = (laneTop - laneBottom) * LANE_MARGIN;
+        QwtScaleMap laneMap;
+        laneMap.setPaintInterval(yMap.transform(laneBottom + margin),
+                                 yMap.transform(laneTop - margin));
+        laneMap.setScaleInterval(lmin, lmax);
+
+        painter->save();
+        painter->setClipRect(laneRect, Qt::IntersectClip);
+        drawEnvelope(painter, xMap, laneMap, canvasRect, from, to);
+        painter->restore();
+    }
+    else
+    {
+        drawEnvelope(painter, xMap, yMap, canvasRect, from, to);
+    }
+}
+
+void FrameBufferCurve::drawEnvelope(QPainter* painter,
+                                    const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                                    const QRectF& canvasRect, int from, int to) const
+{
+    if (series()->beginEnvelope(xMap, from, to))
+    {
+        QwtPlotCurve::drawSeries(painter, xMap, yMap, canvasRect, 0, -1);
+        series()->endEnvelope();
+    }
+    else
+    {
+        QwtPlotCurve::drawSeries(painter, xMap, yMap, canvasRect, from, to);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef FRAMEBUFFERCURVE_H
+#define FRAMEBUFFERCURVE_H
+
+#include <qwt_plot_curve.h>
+
+#include "framebufferseries.h"
+
+/**
+ * Curve for displaying a `FrameBufferSeries`.
+ *
+ * When drawn, series is reduced to a per pixel envelope so that
+ * drawing time depends on the canvas width instead of the number of
+ * samples. See `FrameBufferSeries::beginEnvelope()`.
+ */
+class FrameBufferCurve : public QwtPlotCurve
+{
+public:
+    FrameBufferCurve(QString title, const XFrameBuffer* x, const FrameBuffer* y);
+
+    FrameBufferSeries* series();
+    const FrameBufferSeries* series() const;
+
+    /// When set, curve isn't painted by the plot but by a `CurveCache`
+    void setCached(bool cached);
+    bool isCached() const;
+
+    /**
+     * Draws the curve in a horizontal lane between `bottom` and `top`
+     * of the Y axis instead of at its actual values. Samples are
+     * scaled to fit the lane, either to their own limits or to
+     * `[yMin, yMax]` if `autoScaled` is false. Nothing is drawn outside
+     * the lane and lanes that are out of view are skipped.
+     */
+    void setLane(double bottom, double top,
+                 bool autoScaled, double yMin = 0, double yMax = 1);
+    /// Returns to drawing actual values
+    void clearLane();
+
+    void draw(QPainter* painter,
+              const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+              const QRectF& canvasRect) const override;
+    void drawSeries(QPainter* painter,
+                    const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                    const QRectF& canvasRect, int from, int to) const override;
+
+private:
+    bool _cached;
+    bool inLane;
+    double laneBottom, laneTop;
+    bool laneAutoScaled;
+    double laneMin, laneMax;
+
+    /// Draws the series, reduced to an envelope if possible
+    void drawEnvelope(QPainter* painter,
+                      const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                      const QRectF& canvasRect, int from, int to) const;
+};
+
+#endif // FRAMEBUFFERCURVE_H
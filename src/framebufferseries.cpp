@@ -18,6 +18,7 @@
 */
 
 #include <math.h>
+#include <algorithm>
 #include "framebufferseries.h"
 
 FrameBufferSeries::FrameBufferSeries(const XFrameBuffer* x, const FrameBuffer* y)
@@ -26,7 +27,8 @@ FrameBufferSeries::FrameBufferSeries(const XFrameBuffer* x, const FrameBuffer* y
     _y = y;
 
     int_index_start = 0;
-    int_index_end = _y->size();
+    int_index_end = _y->size() - 1;
+    useEnvelope = false;
 }
 
 void FrameBufferSeries::setX(const XFrameBuffer* x)
@@ -34,14 +36,42 @@ void FrameBufferSeries::setX(const XFrameBuffer* x)
     _x = x;
 }
 
+void FrameBufferSeries::setY(const FrameBuffer* y)
+{
+    _y = y;
+}
+
+const XFrameBuffer* FrameBufferSeries::xData() const
+{
+    return _x;
+}
+
+const FrameBuffer* FrameBufferSeries::yData() const
+{
+    return _y;
+}
+
+int FrameBufferSeries::startIndex() const
+{
+    // skip invalid (not received) samples at the beginning of the buffer
+    int firstValid = _y->size() - _y->numValid();
+    return std::max(int_index_start, firstValid);
+}
+
 size_t FrameBufferSeries::size() const
 {
-    return int_index_end - int_index_start + 1;
+    if (useEnvelope) return envelope.size();
+
+    int start = startIndex();
+    if (int_index_end < start) return 0;
+    return int_index_end - start + 1;
 }
 
 QPointF FrameBufferSeries::sample(size_t i) const
 {
-    i += int_index_start;
+    if (useEnvelope) return envelope[i];
+
+    i += startIndex();
     return QPointF(_x->sample(i), _y->sample(i));
 }
 
@@ -81,3 +111,102 @@ void FrameBufferSeries::setRectOfInterest(const QRectF& rect)
         int_index_end += 1;
     }
 }
+
+bool FrameBufferSeries::indexRange(double xmin, double xmax, int& from, int& to) const
+{
+    int start = startIndex();
+    if (int_index_end < start) return false;
+
+    int first = _x->findIndex(xmin);
+    int last = _x->findIndex(xmax);
+    if (first == XFrameBuffer::OUT_OF_RANGE)
+    {
+        // left of data, or right of it
+        if (xmin > _x->sample(_x->size() - 1)) return false;
+        first = start;
+    }
+    if (last == XFrameBuffer::OUT_OF_RANGE)
+    {
+        if (xmax < _x->sample(0)) return false;
+        last = int_index_end;
+    }
+
+    first = std::max(first - 1, start);
+    last = std::min(last + 1, int_index_end);
+    if (last < first) return false;
+
+    from = first - start;
+    to = last - start;
+    return true;
+}
+
+bool FrameBufferSeries::beginEnvelope(const QwtScaleMap& xMap, int from, int to) const
+{
+    /// Envelope is used when there are more samples than this per pixel
+    const int MIN_SAMPLES_PER_PIXEL = 4;
+
+    useEnvelope = false;
+
+    int start = startIndex() + from;
+    int end = to < 0 ? int_index_end : startIndex() + to;
+    end = std::min(end, int_index_end);
+    if (end < start) return false;
+
+    // width of the range in pixels
+    double width = xMap.transform(_x->sample(end)) - xMap.transform(_x->sample(start));
+    if (xMap.p1() > xMap.p2() ||
+        (end - start + 1) <= MIN_SAMPLES_PER_PIXEL * std::max(width, 1.))
+    {
+        return false;
+    }
+
+    envelope.clear();
+    envelope.reserve(4 * (size_t(width) + 2));
+
+    int i = start;
+    while (i <= end)
+    {
+        // find the last sample of the pixel column of sample `i`
+        double xi = _x->sample(i);
+        double column = floor(xMap.transform(xi));
+        double xNext = xMap.invTransform(column + 1);
+        int j = _x->findIndex(xNext);
+        if (j == XFrameBuffer::OUT_OF_RANGE || j > end)
+        {
+            j = end;
+        }
+        else if (j > i && _x->sample(j) >= xNext)
+        {
+            j--;            // belongs to next column
+        }
+        if (j < i) j = i;
+
+        if (j - i < 4)
+        {
+            for (int k = i; k <= j; k++)
+            {
+                envelope.push_back(QPointF(_x->sample(k), _y->sample(k)));
+            }
+        }
+        else
+        {
+            // order of min and max doesn't matter, they are in the same column
+            Range lim = _y->rangeLimits(i, j + 1);
+            double xm = _x->sample((i + j) / 2);
+            envelope.push_back(QPointF(xi, _y->sample(i)));
+            envelope.push_back(QPointF(xm, lim.start));
+            envelope.push_back(QPointF(xm, lim.end));
+            envelope.push_back(QPointF(_x->sample(j), _y->sample(j)));
+        }
+
+        i = j + 1;
+    }
+
+    useEnvelope = true;
+    return true;
+}
+
+void FrameBufferSeries::endEnvelope() const
+{
+    useEnvelope = false;
+}
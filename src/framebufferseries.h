@@ -20,9 +20,11 @@
 #ifndef FRAMEBUFFERSERIES_H
 #define FRAMEBUFFERSERIES_H
 
+#include <vector>
 #include <QPointF>
 #include <QRectF>
 #include <qwt_series_data.h>
+#include <qwt_scale_map.h>
 
 #include "framebuffer.h"
 
@@ -38,6 +40,9 @@ public:
     FrameBufferSeries(const XFrameBuffer* x, const FrameBuffer* y);
 
     void setX(const XFrameBuffer* x);
+    void setY(const FrameBuffer* y);
+    const XFrameBuffer* xData() const;
+    const FrameBuffer* yData() const;
 
     // QwtSeriesData implementations
     size_t size() const;
@@ -45,12 +50,40 @@ public:
     QRectF boundingRect() const;
     void setRectOfInterest(const QRectF& rect);
 
+    /**
+     * Finds the range of series indexes that covers X values between
+     * `xmin` and `xmax`, including one sample outside at each
+     * side. Returns `false` if range is empty.
+     */
+    bool indexRange(double xmin, double xmax, int& from, int& to) const;
+
+    /**
+     * Reduces the series range `[from, to]` to an envelope for drawing
+     * with given X scale map, until `endEnvelope()` is called. `to < 0`
+     * means the last sample.
+     *
+     * If there are many more samples than pixels, series is replaced
+     * with first, minimum, maximum and last samples of each pixel
+     * column. Drawn lines cover the same pixels as the full
+     * series. Returns `false` and leaves the series unchanged
+     * otherwise.
+     */
+    bool beginEnvelope(const QwtScaleMap& xMap, int from = 0, int to = -1) const;
+    /// Returns to serving actual samples
+    void endEnvelope() const;
+
 private:
     const XFrameBuffer* _x;
     const FrameBuffer* _y;
 
     int int_index_start; ///< starting index of "rectangle of interest"
     int int_index_end;   ///< ending index of "rectangle of interest"
+
+    mutable bool useEnvelope;
+    mutable std::vector<QPointF> envelope;
+
+    /// Returns the first index to be displayed, excluding invalid samples
+    int startIndex() const;
 };
 
 #endif // FRAMEBUFFERSERIES_H
@@ -208,6 +208,8 @@ unsigned FramedReader::readData()
             numBytesRead++;
             if (c == syncWord[sync_i]) // correct sync byte?
             {
+                markRaw(numBytesRead-1, sync_i ? ByteRing::SyncByte :
+                        ByteRing::SyncByte | ByteRing::FrameStart);
                 sync_i++;
                 if (sync_i == (unsigned) syncWord.length())
                 {
@@ -249,14 +251,17 @@ unsigned FramedReader::readData()
             // validate the size field
             if (frameSize == 0)
             {
-                qCritical() << "Frame size is read as 0!";
+                reportError(tr("Frame size is read as 0"), QString(), QtCriticalMsg);
+                markRaw(numBytesRead-1, ByteRing::Error);
                 reset();
             }
             else if (frameSize % (_numChannels * sampleSize) != 0)
             {
-                qCritical() <<
-                    QString("Payload size is not multiple of %1 (#channels * sample size)!") \
-                    .arg(_numChannels * sampleSize);
+                reportError(
+                    tr("Payload size is not multiple of %1 (#channels * sample size)")
+                    .arg(_numChannels * sampleSize),
+                    QString("size: %1").arg(frameSize), QtCriticalMsg);
+                markRaw(numBytesRead-1, ByteRing::Error);
                 reset();
             }
             else
@@ -274,7 +279,10 @@ unsigned FramedReader::readData()
             }
             else // read data bytes and checksum
             {
-                readFrameDataAndCheck();
+                if (!readFrameDataAndCheck())
+                {
+                    markRaw(numBytesRead + frameSize, ByteRing::Error);
+                }
                 numBytesRead += checksumEnabled ? frameSize+1 : frameSize;
                 reset();
             }
@@ -294,13 +302,13 @@ void FramedReader::reset()
 }
 
 // Important: this function assumes device has enough bytes to read a full frames data and checksum
-void FramedReader::readFrameDataAndCheck()
+bool FramedReader::readFrameDataAndCheck()
 {
     // if paused just read and waste data
     if (paused)
     {
         _device->read(checksumEnabled ? frameSize+1 : frameSize);
-        return;
+        return true;
     }
 
     // a package is 1 set of samples for all channels
@@ -328,10 +336,14 @@ void FramedReader::readFrameDataAndCheck()
     {
         // commit data
         feedOut(samples);
+        return true;
     }
     else
     {
-        qCritical() << "Checksum failed! Received:" << rChecksum << "Calculated:" << calcChecksum;
+        reportError(tr("Checksum failed"),
+                    QString("received: %1 calculated: %2").arg(rChecksum).arg(calcChecksum),
+                    QtCriticalMsg);
+        return false;
     }
 }
 
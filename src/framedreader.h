@@ -78,7 +78,8 @@ private:
     template<typename T> double readSampleAs();
     /// reads payload portion of the frame, calculates checksum and commits data
     /// @note should be called only if there are enough bytes on device
-    void readFrameDataAndCheck();
+    /// @return false if checksum failed
+    bool readFrameDataAndCheck();
 
     unsigned readData() override;
 
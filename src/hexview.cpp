@@ -0,0 +1,232 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <QContextMenuEvent>
+#include <QFontDatabase>
+#include <QMenu>
+#include <QPainter>
+#include <QScrollBar>
+
+#include "hexview.h"
+
+/// Left and right padding of text (px)
+static const int MARGIN = 4;
+/// Number of characters in the offset column
+static const int OFFSET_CHARS = 10;
+/// Column (in characters) where hex bytes start
+static const int HEX_COLUMN = OFFSET_CHARS + 2;
+
+static const QColor SYNC_COLOR(180, 210, 255);
+static const QColor ERROR_COLOR(255, 170, 170);
+static const QColor FRAME_COLOR(0, 90, 200);
+
+HexView::HexView(QWidget* parent) :
+    QAbstractScrollArea(parent), ring(RING_SIZE)
+{
+    _reader = nullptr;
+    firstRow = 0;
+    lastEnd = 0;
+
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    viewport()->setAutoFillBackground(true);
+    viewport()->setBackgroundRole(QPalette::Base);
+    setToolTip(tr("Raw bytes read from the port, only recorded while visible.\n"
+                  "Blue: sync bytes, line: start of a frame, red: error."));
+
+    updateTimer.setInterval(UPDATE_PERIOD);
+    connect(&updateTimer, &QTimer::timeout, this, &HexView::onUpdateTimeout);
+
+    updateScrollBars();
+}
+
+HexView::~HexView()
+{
+    if (_reader != nullptr) _reader->setRawTap(nullptr);
+}
+
+void HexView::setReader(AbstractReader* reader)
+{
+    if (_reader != nullptr) _reader->setRawTap(nullptr);
+    _reader = reader;
+    if (_reader != nullptr && isVisible()) _reader->setRawTap(&ring);
+}
+
+void HexView::clear()
+{
+    ring.clear();
+    firstRow = ring.begin() / ROW_BYTES;
+    lastEnd = ring.end();
+    updateScrollBars();
+    viewport()->update();
+}
+
+unsigned HexView::numRows() const
+{
+    if (ring.begin() == ring.end()) return 0;
+    return (ring.end() + ROW_BYTES - 1) / ROW_BYTES - ring.begin() / ROW_BYTES;
+}
+
+int HexView::visibleRows() const
+{
+    return std::max(1, viewport()->height() / fontMetrics().lineSpacing());
+}
+
+void HexView::updateScrollBars()
+{
+    int rows = visibleRows();
+    auto vbar = verticalScrollBar();
+    vbar->setRange(0, std::max(0, int(numRows()) - rows));
+    vbar->setPageStep(rows);
+
+    const int cw = fontMetrics().horizontalAdvance('0');
+    const int rowWidth = (HEX_COLUMN + 4 * ROW_BYTES + 1) * cw + 2 * MARGIN;
+    int width = viewport()->width();
+    auto hbar = horizontalScrollBar();
+    hbar->setRange(0, std::max(0, rowWidth - width));
+    hbar->setPageStep(width);
+    hbar->setSingleStep(cw);
+}
+
+void HexView::onUpdateTimeout()
+{
+    if (ring.end() == lastEnd) return;
+
+    auto vbar = verticalScrollBar();
+    bool atBottom = vbar->value() == vbar->maximum();
+
+    quint64 newFirstRow = ring.begin() / ROW_BYTES;
+    int dropped = std::min<quint64>(newFirstRow - firstRow, vbar->value());
+    firstRow = newFirstRow;
+    lastEnd = ring.end();
+
+    updateScrollBars();
+    if (atBottom)
+    {
+        vbar->setValue(vbar->maximum());
+    }
+    else
+    {
+        // keep showing the same rows while they are in the buffer
+        vbar->setValue(vbar->value() - dropped);
+    }
+    viewport()->update();
+}
+
+void HexView::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event);
+
+    static const char hexDigits[] = "0123456789ABCDEF";
+
+    QPainter painter(viewport());
+    painter.setFont(font());
+
+    const QFontMetrics fm = fontMetrics();
+    const int cw = fm.horizontalAdvance('0');
+    const int lineSpacing = fm.lineSpacing();
+    const int x0 = MARGIN - horizontalScrollBar()->value();
+    const int asciiColumn = HEX_COLUMN + 3 * ROW_BYTES + 1;
+    const QColor textColor = palette().color(QPalette::Text);
+
+    const quint64 begin = ring.begin();
+    const quint64 end = ring.end();
+    const unsigned first = verticalScrollBar()->value();
+    const unsigned last = std::min(numRows(), first + visibleRows() + 1);
+
+    int y = 0;
+    for (unsigned r = first; r < last; r++, y += lineSpacing)
+    {
+        const quint64 rowStart = (firstRow + r) * ROW_BYTES;
+        char hex[ROW_BYTES * 3];
+        char ascii[ROW_BYTES];
+        std::fill_n(hex, sizeof(hex), ' ');
+        std::fill_n(ascii, sizeof(ascii), ' ');
+
+        for (unsigned b = 0; b < ROW_BYTES; b++)
+        {
+            const quint64 pos = rowStart + b;
+            if (pos < begin || pos >= end) continue;
+
+            const quint8 v = ring.byte(pos);
+            hex[b * 3] = hexDigits[v >> 4];
+            hex[b * 3 + 1] = hexDigits[v & 0x0F];
+            ascii[b] = (v >= 0x20 && v < 0x7F) ? char(v) : '.';
+
+            const quint8 m = ring.marks(pos);
+            if (!m) continue;
+
+            const int hx = x0 + (HEX_COLUMN + 3 * b) * cw;
+            const int ax = x0 + (asciiColumn + b) * cw;
+            if (m & (ByteRing::Error | ByteRing::SyncByte))
+            {
+                QColor c = (m & ByteRing::Error) ? ERROR_COLOR : SYNC_COLOR;
+                painter.fillRect(hx, y, 2 * cw, lineSpacing, c);
+                painter.fillRect(ax, y, cw, lineSpacing, c);
+            }
+            if (m & ByteRing::FrameStart)
+            {
+                painter.setPen(FRAME_COLOR);
+                painter.drawLine(hx - cw / 2, y, hx - cw / 2, y + lineSpacing - 1);
+                painter.drawLine(ax, y, ax, y + lineSpacing - 1);
+            }
+        }
+
+        const int baseline = y + fm.ascent();
+        painter.setPen(textColor);
+        painter.drawText(x0, baseline,
+                         QString("%1").arg(rowStart, OFFSET_CHARS, 16, QChar('0')).toUpper());
+        painter.drawText(x0 + HEX_COLUMN * cw, baseline,
+                         QString::fromLatin1(hex, sizeof(hex)));
+        painter.drawText(x0 + asciiColumn * cw, baseline,
+                         QString::fromLatin1(ascii, sizeof(ascii)));
+    }
+}
+
+void HexView::resizeEvent(QResizeEvent* event)
+{
+    auto vbar = verticalScrollBar();
+    bool atBottom = vbar->value() == vbar->maximum();
+
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+
+    if (atBottom) vbar->setValue(vbar->maximum());
+}
+
+void HexView::showEvent(QShowEvent* event)
+{
+    QAbstractScrollArea::showEvent(event);
+    if (_reader != nullptr) _reader->setRawTap(&ring);
+    updateTimer.start();
+}
+
+void HexView::hideEvent(QHideEvent* event)
+{
+    QAbstractScrollArea::hideEvent(event);
+    if (_reader != nullptr) _reader->setRawTap(nullptr);
+    updateTimer.stop();
+}
+
+void HexView::contextMenuEvent(QContextMenuEvent* event)
+{
+    QMenu menu(this);
+    menu.addAction(tr("Clear"), this, &HexView::clear);
+    menu.exec(event->globalPos());
+}
@@ -0,0 +1,83 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEXVIEW_H
+#define HEXVIEW_H
+
+#include <QAbstractScrollArea>
+#include <QTimer>
+
+#include "bytering.h"
+#include "abstractreader.h"
+
+/**
+ * Displays raw bytes consumed by the reader as a hex and ASCII dump.
+ *
+ * Bytes are tapped into a fixed size ring only while the view is
+ * visible, so it costs nothing when hidden. Sync bytes, frame starts
+ * and errors marked by the reader are highlighted. Only visible rows
+ * are formatted when painting.
+ */
+class HexView : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+public:
+    explicit HexView(QWidget* parent = 0);
+    ~HexView();
+
+    /// Sets the reader to tap, can be `nullptr`
+    void setReader(AbstractReader* reader);
+
+public slots:
+    void clear();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+    void contextMenuEvent(QContextMenuEvent* event) override;
+
+private:
+    /// Number of bytes kept
+    static const unsigned RING_SIZE = 1024 * 1024;
+    /// Number of bytes displayed per row
+    static const unsigned ROW_BYTES = 16;
+    /// View is updated at most once in this period (ms)
+    static const int UPDATE_PERIOD = 50;
+
+    ByteRing ring;
+    AbstractReader* _reader;
+    QTimer updateTimer;
+    quint64 firstRow;   ///< absolute index of first stored row
+    quint64 lastEnd;    ///< `ring.end()` at last update
+
+    /// Number of stored rows
+    unsigned numRows() const;
+    /// Number of rows that fits the viewport
+    int visibleRows() const;
+    void updateScrollBars();
+
+private slots:
+    /// Checks for new data and updates the view
+    void onUpdateTimeout();
+};
+
+#endif // HEXVIEW_H
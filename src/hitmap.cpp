@@ -0,0 +1,99 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <algorithm>
+
+#include "hitmap.h"
+
+HitMap::Axis HitMap::Axis::fromRange(double s1, double s2, double p1, double p2, int origin)
+{
+    Axis axis;
+    axis.scale = s2 != s1 ? (p2 - p1) / (s2 - s1) : 0;
+    axis.offset = p1 - s1 * axis.scale - origin;
+    return axis;
+}
+
+double HitMap::Axis::cell(double value) const
+{
+    return floor(offset + value * scale);
+}
+
+HitMap::HitMap()
+{
+    _width = 0;
+    _height = 0;
+    _maxCount = 0;
+}
+
+void HitMap::reset(int width, int height)
+{
+    _width = width;
+    _height = height;
+    _maxCount = 0;
+    hits.assign((size_t) width * height, 0);
+}
+
+void HitMap::add(const FrameBuffer* x, const FrameBuffer* y,
+                 unsigned start, unsigned end, Axis xAxis, Axis yAxis)
+{
+    for (unsigned i = start; i < end; i++)
+    {
+        double px = xAxis.cell(x->sample(i));
+        double py = yAxis.cell(y->sample(i));
+        // also rejects NaN
+        if (!(px >= 0 && px < _width && py >= 0 && py < _height)) continue;
+
+        quint32 c = ++hits[(size_t) py * _width + (size_t) px];
+        _maxCount = std::max(_maxCount, c);
+    }
+}
+
+int HitMap::width() const
+{
+    return _width;
+}
+
+int HitMap::height() const
+{
+    return _height;
+}
+
+quint32 HitMap::count(int x, int y) const
+{
+    return hits[(size_t) y * _width + x];
+}
+
+const quint32* HitMap::row(int y) const
+{
+    return &hits[(size_t) y * _width];
+}
+
+quint32 HitMap::maxCount() const
+{
+    return _maxCount;
+}
+
+int HitMap::alpha(quint32 count, quint32 maxCount)
+{
+    if (count == 0) return 0;
+
+    int a = MIN_ALPHA + (255 - MIN_ALPHA) * log(1. + count) / log(1. + maxCount);
+    return std::min(a, 255);
+}
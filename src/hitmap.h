@@ -0,0 +1,78 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HITMAP_H
+#define HITMAP_H
+
+#include <vector>
+#include <QtGlobal>
+
+#include "framebuffer.h"
+
+/**
+ * Counts how many (x, y) samples fall into each cell of a grid. Used
+ * for density drawing of `XYCurve`.
+ */
+class HitMap
+{
+public:
+    /// Linear mapping of a value to cell coordinate: `offset + value * scale`
+    struct Axis
+    {
+        double offset;
+        double scale;
+
+        /// Returns the mapping of `[s1, s2]` to `[p1, p2]`, shifted by `-origin`
+        static Axis fromRange(double s1, double s2, double p1, double p2, int origin);
+        /// Returns the cell index of `value`, may be outside of grid or NaN
+        double cell(double value) const;
+    };
+
+    /// Minimum alpha of cells that have hits
+    static const int MIN_ALPHA = 64;
+
+    HitMap();
+
+    /// Resizes the grid and clears all counts
+    void reset(int width, int height);
+    /// Counts samples `[start, end)`, samples outside the grid are ignored
+    void add(const FrameBuffer* x, const FrameBuffer* y,
+             unsigned start, unsigned end, Axis xAxis, Axis yAxis);
+
+    int width() const;
+    int height() const;
+    quint32 count(int x, int y) const;
+    /// Returns counts of row `y`
+    const quint32* row(int y) const;
+    quint32 maxCount() const;
+
+    /**
+     * Returns the alpha for a cell. Intensity is logarithmic so that
+     * rarely visited cells are still visible. 0 for cells without hits.
+     */
+    static int alpha(quint32 count, quint32 maxCount);
+
+private:
+    int _width;
+    int _height;
+    quint32 _maxCount;
+    std::vector<quint32> hits;
+};
+
+#endif // HITMAP_H
@@ -0,0 +1,63 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <math.h>
+
+#include "lanescaledraw.h"
+
+LaneScaleDraw::LaneScaleDraw(QStringList names)
+{
+    _names = names;
+}
+
+QwtText LaneScaleDraw::label(double value) const
+{
+    // only lane centers are labeled
+    double center = round(value);
+    if (fabs(value - center) > 1e-6) return QString("");
+
+    int index = _names.size() - 1 - (int) center;
+    if (index >= 0 && index < _names.size())
+    {
+        return _names[index];
+    }
+    else
+    {
+        return QString("");
+    }
+}
+
+QwtScaleDiv LaneScaleEngine::divideScale(double x1, double x2, int maxMajorSteps,
+                                         int maxMinorSteps, double stepSize) const
+{
+    Q_UNUSED(maxMajorSteps);
+    Q_UNUSED(maxMinorSteps);
+    Q_UNUSED(stepSize);
+
+    QList<double> ticks;
+    for (double t = ceil(qMin(x1, x2)); t <= qMax(x1, x2); t++)
+    {
+        ticks << t;
+    }
+
+    QwtScaleDiv div(qMin(x1, x2), qMax(x1, x2), QList<double>(), QList<double>(), ticks);
+    if (x1 > x2) div.invert();
+    return div;
+}
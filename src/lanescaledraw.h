@@ -0,0 +1,54 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef LANESCALEDRAW_H
+#define LANESCALEDRAW_H
+
+#include <QStringList>
+#include <qwt_scale_draw.h>
+#include <qwt_scale_engine.h>
+#include <qwt_text.h>
+
+/**
+ * Labels the Y axis of a plot showing channels in lanes. Lanes are
+ * centered at integer values, first lane is at the top.
+ */
+class LaneScaleDraw : public QwtScaleDraw
+{
+public:
+    explicit LaneScaleDraw(QStringList names);
+    QwtText label(double value) const;
+
+private:
+    QStringList _names;
+};
+
+/**
+ * Places a major tick at every lane center so that each lane gets a
+ * label from `LaneScaleDraw`, regardless of the number of lanes.
+ */
+class LaneScaleEngine : public QwtLinearScaleEngine
+{
+public:
+    QwtScaleDiv divideScale(double x1, double x2, int maxMajorSteps,
+                            int maxMinorSteps, double stepSize = 0.0) const;
+};
+
+#endif // LANESCALEDRAW_H
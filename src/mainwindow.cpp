@@ -31,6 +31,7 @@
 #include <QtDebug>
 #include <QCommandLineParser>
 #include <QFileInfo>
+#include <QMutexLocker>
 #include <qwt_plot.h>
 #include <limits.h>
 #include <cmath>
@@ -39,6 +40,9 @@
 
 #include <plot.h>
 #include <barplot.h>
+#include <spectrumplot.h>
+#include <xyplot.h>
+#include <persistenceplot.h>
 
 #include "framebufferseries.h"
 #include "defines.h"
@@ -58,12 +62,18 @@ const QMap<int, QString> panelSettingMap({
         {3, "Commands"},
         {4, "Record"},
         {5, "TextView"},
-        {6, "Log"}
+        {6, "RawData"},
+        {7, "Filter"},
+        {8, "Math"},
+        {9, "Trigger"},
+        {10, "Log"}
     });
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow),
+    droppedLog(0),
+    logUpdateQueued(false),
     aboutDialog(this),
     portControl(&serialPort),
     secondaryPlot(NULL),
@@ -72,12 +82,18 @@ MainWindow::MainWindow(QWidget *parent) :
     dataFormatPanel(&serialPort),
     recordPanel(&stream),
     textView(&stream),
+    filterPanel(&channelFilters),
+    mathPanel(&mathChannels, stream.infoModel()),
+    triggerPanel(&stream),
+    channelStats(&stream),
     updateCheckDialog(this),
     bpsLabel(&portControl, &dataFormatPanel, this)
 {
     ui->setupUi(this);
+    ui->ptLog->setMaximumBlockCount(MAX_LOG_LINES);
 
     plotMan = new PlotManager(ui->plotArea, &plotMenu, &stream);
+    plotMan->setReplotScheduler(&replotScheduler);
 
     ui->tabWidget->insertTab(0, &portControl, "Port");
     ui->tabWidget->insertTab(1, &dataFormatPanel, "Data Format");
@@ -85,6 +101,10 @@ MainWindow::MainWindow(QWidget *parent) :
     ui->tabWidget->insertTab(3, &commandPanel, "Commands");
     ui->tabWidget->insertTab(4, &recordPanel, "Record");
     ui->tabWidget->insertTab(5, &textView, "Text View");
+    ui->tabWidget->insertTab(6, &hexView, "Raw Data");
+    ui->tabWidget->insertTab(7, &filterPanel, "Filter");
+    ui->tabWidget->insertTab(8, &mathPanel, "Math");
+    ui->tabWidget->insertTab(9, &triggerPanel, "Trigger");
     ui->tabWidget->setCurrentIndex(0);
     auto tbPortControl = portControl.toolBar();
     addToolBar(tbPortControl);
@@ -117,12 +137,29 @@ MainWindow::MainWindow(QWidget *parent) :
     group->addAction(ui->actionVertical);
     group->addAction(ui->actionHorizontal);
 
+    // only one secondary plot can be shown at a time
+    auto plotGroup = new QActionGroup(this);
+    plotGroup->setExclusionPolicy(QActionGroup::ExclusionPolicy::ExclusiveOptional);
+    plotGroup->addAction(ui->actionBarPlot);
+    plotGroup->addAction(ui->actionSpectrum);
+    plotGroup->addAction(ui->actionXYPlot);
+    plotGroup->addAction(ui->actionPersistence);
+
     // init UI signals
 
     // Secondary plot menu signals
     connect(ui->actionBarPlot, &QAction::triggered,
             this, &MainWindow::showBarPlot);
 
+    connect(ui->actionSpectrum, &QAction::triggered,
+            this, &MainWindow::showSpectrum);
+
+    connect(ui->actionXYPlot, &QAction::triggered,
+            this, &MainWindow::showXYPlot);
+
+    connect(ui->actionPersistence, &QAction::triggered,
+            this, &MainWindow::showPersistence);
+
     connect(ui->actionVertical, &QAction::triggered,
             [this](bool checked)
             {
@@ -189,6 +226,27 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(&plotControlPanel, &PlotControlPanel::lineThicknessChanged,
             plotMan, &PlotManager::setLineThickness);
 
+    connect(&plotControlPanel, &PlotControlPanel::compressBufferChanged,
+            &stream, &Stream::setCompressed);
+
+    connect(&plotControlPanel, &PlotControlPanel::incrementalChanged,
+            plotMan, &PlotManager::setIncremental);
+
+    connect(&plotControlPanel, &PlotControlPanel::maxFpsChanged,
+            &replotScheduler, &ReplotScheduler::setMaxFps);
+
+    connect(&plotControlPanel, &PlotControlPanel::statsModeChanged,
+            [this](int mode)
+            {
+                channelStats.setMode((ChannelStats::Mode) mode);
+            });
+
+    connect(&triggerPanel, &TriggerPanel::triggerEnabledChanged,
+            [this](bool enabled)
+            {
+                plotMan->setTriggerCapture(enabled ? triggerPanel.capture() : nullptr);
+            });
+
     // plot toolbar signals
     QObject::connect(ui->actionClear, SIGNAL(triggered(bool)),
                      this, SLOT(clearPlot()));
@@ -227,6 +285,7 @@ MainWindow::MainWindow(QWidget *parent) :
     // init plot
     numOfSamples = plotControlPanel.numOfSamples();
     stream.setNumSamples(numOfSamples);
+    stream.setCompressed(plotControlPanel.compressBuffer());
     plotControlPanel.setChannelInfoModel(stream.infoModel());
 
     // init scales
@@ -239,6 +298,8 @@ MainWindow::MainWindow(QWidget *parent) :
                       plotControlPanel.xMin(), plotControlPanel.xMax());
     plotMan->setNumOfSamples(numOfSamples);
     plotMan->setPlotWidth(plotControlPanel.plotWidth());
+    replotScheduler.setMaxFps(plotControlPanel.maxFps());
+    plotMan->setIncremental(plotControlPanel.incremental());
 
     // init bps (bits per second) counter
     ui->statusBar->addPermanentWidget(&bpsLabel);
@@ -250,10 +311,19 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(&sampleCounter, &SampleCounter::spsChanged,
             this, &MainWindow::onSpsChanged);
 
+    // Init plot fps (frames per second) counter
+    fpsLabel.setText("0fps");
+    fpsLabel.setToolTip(tr("plot updates per second"));
+    ui->statusBar->addPermanentWidget(&fpsLabel);
+    connect(&replotScheduler, &ReplotScheduler::statsChanged,
+            this, &MainWindow::onFpsChanged);
+
     bpsLabel.setMinimumWidth(70);
     bpsLabel.setAlignment(Qt::AlignRight);
     spsLabel.setMinimumWidth(70);
     spsLabel.setAlignment(Qt::AlignRight);
+    fpsLabel.setMinimumWidth(50);
+    fpsLabel.setAlignment(Qt::AlignRight);
 
     // init demo
     QObject::connect(ui->actionDemoMode, &QAction::toggled,
@@ -266,6 +336,9 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(&dataFormatPanel, &DataFormatPanel::sourceChanged,
             this, &MainWindow::onSourceChanged);
     onSourceChanged(dataFormatPanel.activeSource());
+    // connected after the source so that stream gets a valid number of channels
+    channelFilters.connectSink(&mathChannels);
+    mathChannels.connectSink(&stream);
 
     // load default settings
     QSettings settings(PROGRAM_NAME, PROGRAM_NAME);
@@ -383,13 +456,15 @@ void MainWindow::onPortToggled(bool open)
 
 void MainWindow::onSourceChanged(Source* source)
 {
-    source->connectSink(&stream);
+    source->connectSink(&channelFilters);
     source->connectSink(&sampleCounter);
+    hexView.setReader(dynamic_cast<AbstractReader*>(source));
 }
 
 void MainWindow::clearPlot()
 {
     stream.clear();
+    channelStats.reset();
     plotMan->replot();
 }
 
@@ -406,6 +481,13 @@ void MainWindow::onSpsChanged(float sps)
     spsLabel.setText(QString::number(sps, 'f', precision) + "sps");
 }
 
+void MainWindow::onFpsChanged(float fps, unsigned skipped)
+{
+    fpsLabel.setText(QString::number(fps, 'f', 0) + "fps");
+    fpsLabel.setToolTip(
+        tr("plot updates per second\n%1 updates merged in the last second").arg(skipped));
+}
+
 bool MainWindow::isDemoRunning()
 {
     return ui->actionDemoMode->isChecked();
@@ -460,6 +542,7 @@ void MainWindow::showBarPlot(bool show)
     if (show)
     {
         auto plot = new BarPlot(&stream, &plotMenu);
+        plot->setReplotScheduler(&replotScheduler);
         plot->setYAxis(plotControlPanel.autoScale(),
                        plotControlPanel.yMin(),
                        plotControlPanel.yMax());
@@ -473,6 +556,44 @@ void MainWindow::showBarPlot(bool show)
     }
 }
 
+void MainWindow::showSpectrum(bool show)
+{
+    if (show)
+    {
+        showSecondary(new SpectrumPlot(&stream, &plotMenu));
+    }
+    else
+    {
+        hideSecondary();
+    }
+}
+
+void MainWindow::showXYPlot(bool show)
+{
+    if (show)
+    {
+        auto plot = new XYPlot(&stream, &plotMenu);
+        plot->setReplotScheduler(&replotScheduler);
+        showSecondary(plot);
+    }
+    else
+    {
+        hideSecondary();
+    }
+}
+
+void MainWindow::showPersistence(bool show)
+{
+    if (show)
+    {
+        showSecondary(new PersistencePlot(&stream, &plotMenu));
+    }
+    else
+    {
+        hideSecondary();
+    }
+}
+
 void MainWindow::onExportCsv()
 {
     bool wasPaused = ui->actionPause->isChecked();
@@ -519,12 +640,69 @@ void MainWindow::messageHandler(QtMsgType type,
                                 const QString &logString,
                                 const QString &msg)
 {
-    if (ui != NULL)
-        ui->ptLog->appendPlainText(logString);
+    QMutexLocker locker(&logMutex);
+
+    if (pendingLog.size() < MAX_LOG_LINES)
+    {
+        if (logString.length() > MAX_LOG_LINE_LENGTH)
+        {
+            pendingLog.append(logString.left(MAX_LOG_LINE_LENGTH) + "...");
+        }
+        else
+        {
+            pendingLog.append(logString);
+        }
+    }
+    else
+    {
+        droppedLog++;
+    }
+
+    if (type != QtDebugMsg)
+    {
+        pendingStatus = msg.left(MAX_LOG_LINE_LENGTH);
+    }
+
+    if (!logUpdateQueued)
+    {
+        logUpdateQueued = true;
+        // timer must be started from the GUI thread
+        QMetaObject::invokeMethod(this, [this]()
+            {
+                QTimer::singleShot(LOG_UPDATE_PERIOD, this, &MainWindow::updateLog);
+            }, Qt::QueuedConnection);
+    }
+}
+
+void MainWindow::updateLog()
+{
+    QStringList lines;
+    QString status;
+    unsigned dropped;
+    {
+        QMutexLocker locker(&logMutex);
+        lines.swap(pendingLog);
+        status.swap(pendingStatus);
+        dropped = droppedLog;
+        droppedLog = 0;
+        logUpdateQueued = false;
+    }
+
+    if (ui == NULL) return;
+
+    if (dropped)
+    {
+        lines.append(QString("[Warning] %1 messages are dropped").arg(dropped));
+    }
+
+    if (!lines.isEmpty())
+    {
+        ui->ptLog->appendPlainText(lines.join('\n'));
+    }
 
-    if (type != QtDebugMsg && ui != NULL)
+    if (!status.isEmpty())
     {
-        ui->statusBar->showMessage(msg, 5000);
+        ui->statusBar->showMessage(status, 5000);
     }
 }
 
@@ -539,6 +717,9 @@ void MainWindow::saveAllSettings(QSettings* settings)
     commandPanel.saveSettings(settings);
     recordPanel.saveSettings(settings);
     textView.saveSettings(settings);
+    filterPanel.saveSettings(settings);
+    mathPanel.saveSettings(settings);
+    triggerPanel.saveSettings(settings);
     updateCheckDialog.saveSettings(settings);
 }
 
@@ -553,6 +734,9 @@ void MainWindow::loadAllSettings(QSettings* settings)
     commandPanel.loadSettings(settings);
     recordPanel.loadSettings(settings);
     textView.loadSettings(settings);
+    filterPanel.loadSettings(settings);
+    mathPanel.loadSettings(settings);
+    triggerPanel.loadSettings(settings);
     updateCheckDialog.loadSettings(settings);
 }
 
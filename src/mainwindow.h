@@ -32,6 +32,8 @@
 #include <QColor>
 #include <QtGlobal>
 #include <QSettings>
+#include <QMutex>
+#include <QStringList>
 #include <qwt_plot_curve.h>
 
 #include "portcontrol.h"
@@ -43,10 +45,18 @@
 #include "stream.h"
 #include "snapshotmanager.h"
 #include "plotmanager.h"
+#include "replotscheduler.h"
 #include "plotmenu.h"
 #include "updatecheckdialog.h"
 #include "samplecounter.h"
 #include "datatextview.h"
+#include "hexview.h"
+#include "mathchannels.h"
+#include "mathpanel.h"
+#include "channelfilters.h"
+#include "filterpanel.h"
+#include "triggerpanel.h"
+#include "channelstats.h"
 #include "bpslabel.h"
 
 namespace Ui {
@@ -63,11 +73,30 @@ public:
 
     PlotViewSettings viewSettings() const;
 
+    /**
+     * Adds a message to the log. Can be called from any thread.
+     *
+     * Messages are collected and shown in batches so that a burst of
+     * messages doesn't stall the GUI.
+     */
     void messageHandler(QtMsgType type, const QString &logString, const QString &msg);
 
 private:
+    /// Log is updated at most once in this period (ms)
+    static const int LOG_UPDATE_PERIOD = 250;
+    /// Maximum number of lines kept in log view
+    static const int MAX_LOG_LINES = 2000;
+    /// Long log lines are cut to this length (characters)
+    static const int MAX_LOG_LINE_LENGTH = 1000;
+
     Ui::MainWindow *ui;
 
+    QMutex logMutex;         ///< protects below log members
+    QStringList pendingLog;  ///< lines waiting to be added to log view
+    unsigned droppedLog;     ///< number of lines dropped since last update
+    QString pendingStatus;   ///< last message to show in status bar
+    bool logUpdateQueued;
+
     QDialog aboutDialog;
     void setupAboutDialog();
 
@@ -83,14 +112,25 @@ private:
     QWidget* secondaryPlot;
     SnapshotManager snapshotMan;
     SampleCounter sampleCounter;
+    ReplotScheduler replotScheduler;
+    /// @note should be destroyed after the readers (data format panel)
+    ChannelFilters channelFilters;
+    MathChannels mathChannels;
 
     QLabel spsLabel;
+    QLabel fpsLabel;
     CommandPanel commandPanel;
     DataFormatPanel dataFormatPanel;
     RecordPanel recordPanel;
     PlotControlPanel plotControlPanel;
     PlotMenu plotMenu;
     DataTextView textView;
+    /// @note should be destroyed before the readers (data format panel)
+    HexView hexView;
+    FilterPanel filterPanel;
+    MathPanel mathPanel;
+    TriggerPanel triggerPanel;
+    ChannelStats channelStats;
     UpdateCheckDialog updateCheckDialog;
     BPSLabel bpsLabel;
 
@@ -122,8 +162,15 @@ private slots:
 
     void clearPlot();
     void onSpsChanged(float sps);
+    void onFpsChanged(float fps, unsigned skipped);
     void enableDemo(bool enabled);
     void showBarPlot(bool show);
+    void showSpectrum(bool show);
+    void showXYPlot(bool show);
+    void showPersistence(bool show);
+
+    /// Adds pending messages to the log view
+    void updateLog();
 
     void onExportCsv();
     void onExportSvg();
@@ -0,0 +1,146 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "mathchannels.h"
+
+MathChannels::MathChannels()
+{
+    _numInputs = 0;
+    _hasX = false;
+}
+
+unsigned MathChannels::numChannels() const
+{
+    return _numInputs + exprs.size();
+}
+
+bool MathChannels::hasX() const
+{
+    return _hasX;
+}
+
+unsigned MathChannels::numDerived() const
+{
+    return exprs.size();
+}
+
+unsigned MathChannels::numInputs() const
+{
+    return _numInputs;
+}
+
+QStringList MathChannels::expressions() const
+{
+    return texts;
+}
+
+bool MathChannels::setExpressions(const QStringList& exprTexts, QStringList* errors)
+{
+    unsigned oldNum = exprs.size();
+
+    texts = exprTexts;
+    bool r = compileAll(errors);
+
+    if (exprs.size() != (int) oldNum)
+    {
+        Sink::setNumChannels(numChannels(), _hasX);
+        updateNumChannels();
+    }
+
+    return r;
+}
+
+bool MathChannels::compileAll(QStringList* errors)
+{
+    bool r = true;
+    exprs.clear();
+    for (auto& text : texts)
+    {
+        MathExpression expr;
+        QString error;
+        if (!expr.compile(text, _numInputs, &error))
+        {
+            r = false;
+            if (errors != nullptr)
+            {
+                errors->append(QString("'%1': %2").arg(text).arg(error));
+            }
+        }
+        exprs.append(expr);
+    }
+    return r;
+}
+
+void MathChannels::setNumChannels(unsigned nc, bool x)
+{
+    _numInputs = nc;
+    _hasX = x;
+
+    // channel references might have become (in)valid
+    compileAll();
+
+    // followers get derived channels as well
+    Sink::setNumChannels(numChannels(), x);
+    updateNumChannels();
+}
+
+void MathChannels::feedIn(const SamplePack& data)
+{
+    Q_ASSERT(data.numChannels() == _numInputs && data.hasX() == _hasX);
+
+    if (exprs.isEmpty())
+    {
+        Sink::feedIn(data);
+        feedOut(data);
+        return;
+    }
+
+    unsigned ns = data.numSamples();
+    SamplePack out(ns, numChannels(), _hasX);
+
+    size_t chSize = ns * sizeof(double);
+    if (_hasX)
+    {
+        memcpy(out.xData(), data.xData(), chSize);
+    }
+    for (unsigned ci = 0; ci < _numInputs; ci++)
+    {
+        memcpy(out.data(ci), data.data(ci), chSize);
+    }
+
+    for (int i = 0; i < exprs.size(); i++)
+    {
+        double* result = out.data(_numInputs + i);
+        if (exprs[i].isValid())
+        {
+            exprs[i].evaluate(data, result);
+        }
+        else
+        {
+            std::fill(result, result + ns, std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    Sink::feedIn(out);
+    feedOut(out);
+}
@@ -0,0 +1,81 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MATHCHANNELS_H
+#define MATHCHANNELS_H
+
+#include <QList>
+#include <QStringList>
+
+#include "sink.h"
+#include "source.h"
+#include "mathexpression.h"
+
+/**
+ * Adds derived channels, calculated from math expressions of input
+ * channels.
+ *
+ * Sits in between a reader and the `Stream`. Input channels are
+ * passed as is, derived channels are appended after them. When there
+ * are no expressions data is passed through without copying.
+ */
+class MathChannels : public Sink, public Source
+{
+public:
+    MathChannels();
+
+    /**
+     * Sets derived channel expressions. Invalid expressions still
+     * create a channel that produces `NaN` values.
+     *
+     * @param exprTexts one expression per derived channel
+     * @param errors if not null, filled with error messages of invalid expressions
+     * @return false if any of the expressions is invalid
+     */
+    bool setExpressions(const QStringList& exprTexts, QStringList* errors = nullptr);
+
+    /// Returns expression texts
+    QStringList expressions() const;
+
+    /// Returns number of derived channels
+    unsigned numDerived() const;
+
+    /// Returns number of input channels
+    unsigned numInputs() const;
+
+    // implementations for `Source`
+    virtual unsigned numChannels() const;
+    virtual bool hasX() const;
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    unsigned _numInputs;
+    bool _hasX;
+    QStringList texts;
+    QList<MathExpression> exprs; ///< compiled `texts`
+
+    /// Compiles all expressions for current number of inputs
+    bool compileAll(QStringList* errors = nullptr);
+};
+
+#endif // MATHCHANNELS_H
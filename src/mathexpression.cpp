@@ -0,0 +1,563 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "mathexpression.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#ifndef M_E
+#define M_E 2.71828182845904523536
+#endif
+
+namespace
+{
+
+template <typename T, typename F>
+void applyUnary(const T& a, double* out, unsigned n, F f)
+{
+    const double* in = a.data;
+    for (unsigned i = 0; i < n; i++)
+    {
+        out[i] = f(in[i]);
+    }
+}
+
+template <typename T, typename F>
+void applyBinary(const T& a, const T& b, double* out, unsigned n, F f)
+{
+    if (a.isConst)
+    {
+        const double av = a.value;
+        const double* bd = b.data;
+        for (unsigned i = 0; i < n; i++) out[i] = f(av, bd[i]);
+    }
+    else if (b.isConst)
+    {
+        const double* ad = a.data;
+        const double bv = b.value;
+        for (unsigned i = 0; i < n; i++) out[i] = f(ad[i], bv);
+    }
+    else
+    {
+        const double* ad = a.data;
+        const double* bd = b.data;
+        for (unsigned i = 0; i < n; i++) out[i] = f(ad[i], bd[i]);
+    }
+}
+
+} // namespace
+
+MathExpression::MathExpression()
+{
+    _valid = false;
+    maxDepth = 0;
+    pos = 0;
+    _numInputs = 0;
+}
+
+bool MathExpression::isValid() const
+{
+    return _valid;
+}
+
+QString MathExpression::text() const
+{
+    return _text;
+}
+
+bool MathExpression::compile(const QString& expr, unsigned numInputs, QString* error)
+{
+    _text = expr;
+    src = expr;
+    pos = 0;
+    _numInputs = numInputs;
+    parseError.clear();
+    code.clear();
+    maxDepth = 0;
+    _valid = false;
+
+    bool ok = parseExpr();
+    if (ok)
+    {
+        skipSpaces();
+        if (pos < src.length())
+        {
+            ok = fail(QString("Unexpected character '%1'").arg(src[pos]));
+        }
+    }
+
+    if (!ok)
+    {
+        code.clear();
+        if (error != nullptr) *error = parseError;
+        return false;
+    }
+
+    // calculate required stack depth
+    unsigned depth = 0;
+    for (auto& ins : code)
+    {
+        switch (ins.op)
+        {
+            case Op::Channel:
+            case Op::Constant:
+                depth++;
+                break;
+            case Op::Neg:
+            case Op::Func1:
+                break;
+            default:            // binary operators
+                depth--;
+        }
+        maxDepth = std::max(maxDepth, depth);
+    }
+    Q_ASSERT(depth == 1);
+
+    _valid = true;
+    return true;
+}
+
+bool MathExpression::fail(QString msg)
+{
+    parseError = QString("%1 at position %2").arg(msg).arg(pos + 1);
+    return false;
+}
+
+void MathExpression::skipSpaces()
+{
+    while (pos < src.length() && src[pos].isSpace()) pos++;
+}
+
+void MathExpression::emitOp(Op op, Func func)
+{
+    code.push_back({op, func, 0, 0.});
+}
+
+bool MathExpression::parseExpr()
+{
+    if (!parseTerm()) return false;
+
+    while (true)
+    {
+        skipSpaces();
+        if (pos >= src.length()) return true;
+
+        QChar c = src[pos];
+        if (c == '+' || c == '-')
+        {
+            pos++;
+            if (!parseTerm()) return false;
+            emitOp(c == '+' ? Op::Add : Op::Sub);
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+
+bool MathExpression::parseTerm()
+{
+    if (!parseUnary()) return false;
+
+    while (true)
+    {
+        skipSpaces();
+        if (pos >= src.length()) return true;
+
+        QChar c = src[pos];
+        if (c == '*' || c == '/')
+        {
+            pos++;
+            if (!parseUnary()) return false;
+            emitOp(c == '*' ? Op::Mul : Op::Div);
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+
+bool MathExpression::parseUnary()
+{
+    skipSpaces();
+    if (pos < src.length() && src[pos] == '-')
+    {
+        pos++;
+        if (!parseUnary()) return false;
+        emitOp(Op::Neg);
+        return true;
+    }
+    else if (pos < src.length() && src[pos] == '+')
+    {
+        pos++;
+        return parseUnary();
+    }
+    return parsePower();
+}
+
+bool MathExpression::parsePower()
+{
+    if (!parsePrimary()) return false;
+
+    skipSpaces();
+    if (pos < src.length() && src[pos] == '^')
+    {
+        pos++;
+        // right associative, also allows `2^-1`
+        if (!parseUnary()) return false;
+        emitOp(Op::Pow);
+    }
+    return true;
+}
+
+bool MathExpression::parsePrimary()
+{
+    skipSpaces();
+    if (pos >= src.length())
+    {
+        return fail("Unexpected end of expression");
+    }
+
+    QChar c = src[pos];
+    if (c == '(')
+    {
+        pos++;
+        if (!parseExpr()) return false;
+        skipSpaces();
+        if (pos >= src.length() || src[pos] != ')')
+        {
+            return fail("Missing ')'");
+        }
+        pos++;
+        return true;
+    }
+    else if (c.isDigit() || c == '.')
+    {
+        int start = pos;
+        while (pos < src.length() && (src[pos].isDigit() || src[pos] == '.')) pos++;
+        // exponent
+        if (pos < src.length() && (src[pos] == 'e' || src[pos] == 'E'))
+        {
+            int e = pos + 1;
+            if (e < src.length() && (src[e] == '+' || src[e] == '-')) e++;
+            if (e < src.length() && src[e].isDigit())
+            {
+                pos = e;
+                while (pos < src.length() && src[pos].isDigit()) pos++;
+            }
+        }
+
+        bool ok;
+        double value = src.mid(start, pos - start).toDouble(&ok);
+        if (!ok)
+        {
+            pos = start;
+            return fail("Invalid number");
+        }
+        code.push_back({Op::Constant, Func::None, 0, value});
+        return true;
+    }
+    else if (c.isLetter() || c == '_')
+    {
+        int start = pos;
+        while (pos < src.length() && (src[pos].isLetterOrNumber() || src[pos] == '_')) pos++;
+        QString name = src.mid(start, pos - start).toLower();
+
+        // channel reference
+        if (name.startsWith("ch") && name.length() > 2)
+        {
+            bool ok;
+            unsigned index = name.mid(2).toUInt(&ok);
+            if (ok)
+            {
+                if (index >= _numInputs)
+                {
+                    pos = start;
+                    return fail(QString("Channel '%1' doesn't exist").arg(name));
+                }
+                code.push_back({Op::Channel, Func::None, index, 0.});
+                return true;
+            }
+        }
+
+        skipSpaces();
+        if (pos < src.length() && src[pos] == '(')
+        {
+            Func f1 = func1(name);
+            Func f2 = func2(name);
+            bool isPow = name == "pow";
+            if (f1 == Func::None && f2 == Func::None && !isPow)
+            {
+                pos = start;
+                return fail(QString("Unknown function '%1'").arg(name));
+            }
+
+            pos++;
+            if (!parseExpr()) return false;
+            skipSpaces();
+            if (f1 == Func::None) // 2 arguments
+            {
+                if (pos >= src.length() || src[pos] != ',')
+                {
+                    return fail(QString("Function '%1' requires 2 arguments").arg(name));
+                }
+                pos++;
+                if (!parseExpr()) return false;
+                skipSpaces();
+            }
+            if (pos >= src.length() || src[pos] != ')')
+            {
+                return fail("Missing ')'");
+            }
+            pos++;
+
+            if (isPow)
+            {
+                emitOp(Op::Pow);
+            }
+            else if (f1 != Func::None)
+            {
+                emitOp(Op::Func1, f1);
+            }
+            else
+            {
+                emitOp(Op::Func2, f2);
+            }
+            return true;
+        }
+        else if (name == "pi")
+        {
+            code.push_back({Op::Constant, Func::None, 0, M_PI});
+            return true;
+        }
+        else if (name == "e")
+        {
+            code.push_back({Op::Constant, Func::None, 0, M_E});
+            return true;
+        }
+        else
+        {
+            pos = start;
+            return fail(QString("Unknown name '%1'").arg(name));
+        }
+    }
+    else
+    {
+        return fail(QString("Unexpected character '%1'").arg(c));
+    }
+}
+
+MathExpression::Func MathExpression::func1(const QString& name)
+{
+    if (name == "sqrt") return Func::Sqrt;
+    if (name == "abs") return Func::Abs;
+    if (name == "sin") return Func::Sin;
+    if (name == "cos") return Func::Cos;
+    if (name == "tan") return Func::Tan;
+    if (name == "asin") return Func::Asin;
+    if (name == "acos") return Func::Acos;
+    if (name == "atan") return Func::Atan;
+    if (name == "exp") return Func::Exp;
+    if (name == "log") return Func::Log;
+    if (name == "log10") return Func::Log10;
+    if (name == "floor") return Func::Floor;
+    if (name == "ceil") return Func::Ceil;
+    if (name == "round") return Func::Round;
+    return Func::None;
+}
+
+MathExpression::Func MathExpression::func2(const QString& name)
+{
+    if (name == "atan2") return Func::Atan2;
+    if (name == "min") return Func::Min;
+    if (name == "max") return Func::Max;
+    return Func::None;
+}
+
+void MathExpression::evaluate(const SamplePack& input, double* out) const
+{
+    Q_ASSERT(_valid);
+    Q_ASSERT(input.numChannels() >= _numInputs);
+
+    unsigned n = input.numSamples();
+
+    if (regs.size() < maxDepth) regs.resize(maxDepth);
+    for (auto& reg : regs)
+    {
+        if (reg.size() < n) reg.resize(n);
+    }
+
+    std::vector<Operand> stack(maxDepth);
+    unsigned sp = 0;
+    for (auto& ins : code)
+    {
+        switch (ins.op)
+        {
+            case Op::Channel:
+                stack[sp++] = {input.data(ins.channel), 0., false};
+                break;
+            case Op::Constant:
+                stack[sp++] = {nullptr, ins.value, true};
+                break;
+            case Op::Neg:
+            case Op::Func1:
+                unary(ins.op, ins.func, stack[sp-1], regs[sp-1].data(), n);
+                break;
+            default:
+                binary(ins.op, ins.func, stack[sp-2], stack[sp-1], regs[sp-2].data(), n);
+                sp--;
+        }
+    }
+
+    const Operand& result = stack[0];
+    if (result.isConst)
+    {
+        std::fill(out, out + n, result.value);
+    }
+    else
+    {
+        memcpy(out, result.data, n * sizeof(double));
+    }
+}
+
+void MathExpression::unary(Op op, Func func, Operand& a, double* out, unsigned n) const
+{
+    auto calc = [op, func](double x) -> double
+        {
+            if (op == Op::Neg) return -x;
+
+            switch (func)
+            {
+                case Func::Sqrt: return std::sqrt(x);
+                case Func::Abs: return std::fabs(x);
+                case Func::Sin: return std::sin(x);
+                case Func::Cos: return std::cos(x);
+                case Func::Tan: return std::tan(x);
+                case Func::Asin: return std::asin(x);
+                case Func::Acos: return std::acos(x);
+                case Func::Atan: return std::atan(x);
+                case Func::Exp: return std::exp(x);
+                case Func::Log: return std::log(x);
+                case Func::Log10: return std::log10(x);
+                case Func::Floor: return std::floor(x);
+                case Func::Ceil: return std::ceil(x);
+                case Func::Round: return std::round(x);
+                default:
+                    Q_ASSERT(false);
+                    return 0;
+            }
+        };
+
+    if (a.isConst)
+    {
+        a.value = calc(a.value);
+        return;
+    }
+
+    // most common operations get their own loops so that they can be vectorized
+    if (op == Op::Neg)
+    {
+        applyUnary(a, out, n, [](double x) {return -x;});
+    }
+    else if (func == Func::Sqrt)
+    {
+        applyUnary(a, out, n, [](double x) {return std::sqrt(x);});
+    }
+    else if (func == Func::Abs)
+    {
+        applyUnary(a, out, n, [](double x) {return std::fabs(x);});
+    }
+    else
+    {
+        applyUnary(a, out, n, calc);
+    }
+
+    a.data = out;
+}
+
+void MathExpression::binary(Op op, Func func, Operand& a, const Operand& b,
+                            double* out, unsigned n) const
+{
+    auto calc = [op, func](double x, double y) -> double
+        {
+            switch (op)
+            {
+                case Op::Add: return x + y;
+                case Op::Sub: return x - y;
+                case Op::Mul: return x * y;
+                case Op::Div: return x / y;
+                case Op::Pow: return std::pow(x, y);
+                default:
+                    break;
+            }
+            switch (func)
+            {
+                case Func::Atan2: return std::atan2(x, y);
+                case Func::Min: return std::min(x, y);
+                case Func::Max: return std::max(x, y);
+                default:
+                    Q_ASSERT(false);
+                    return 0;
+            }
+        };
+
+    if (a.isConst && b.isConst)
+    {
+        a.value = calc(a.value, b.value);
+        return;
+    }
+
+    switch (op)
+    {
+        case Op::Add:
+            applyBinary(a, b, out, n, [](double x, double y) {return x + y;});
+            break;
+        case Op::Sub:
+            applyBinary(a, b, out, n, [](double x, double y) {return x - y;});
+            break;
+        case Op::Mul:
+            applyBinary(a, b, out, n, [](double x, double y) {return x * y;});
+            break;
+        case Op::Div:
+            applyBinary(a, b, out, n, [](double x, double y) {return x / y;});
+            break;
+        case Op::Pow:
+            if (b.isConst && b.value == 2.)
+            {
+                applyUnary(a, out, n, [](double x) {return x * x;});
+            }
+            else
+            {
+                applyBinary(a, b, out, n, [](double x, double y) {return std::pow(x, y);});
+            }
+            break;
+        default:
+            applyBinary(a, b, out, n, calc);
+    }
+
+    a.data = out;
+    a.isConst = false;
+}
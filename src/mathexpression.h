@@ -0,0 +1,144 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MATHEXPRESSION_H
+#define MATHEXPRESSION_H
+
+#include <vector>
+#include <QString>
+#include <QtGlobal>
+
+#include "samplepack.h"
+
+/**
+ * A math expression of input channels, compiled to a simple stack
+ * based bytecode.
+ *
+ * Supported syntax:
+ *
+ * - channels: `ch0`, `ch1`, ... (zero based)
+ * - numbers: `3`, `0.0625`, `1e-3`, constants `pi` and `e`
+ * - operators: `+ - * / ^` and parentheses, `^` is right associative
+ * - functions: `sqrt abs sin cos tan asin acos atan exp log log10
+ *   floor ceil round` and 2 argument `atan2 min max pow`
+ *
+ * Evaluation is done per `SamplePack`, one instruction at a time over
+ * all samples, so that inner loops are simple enough to be vectorized
+ * by the compiler.
+ */
+class MathExpression
+{
+public:
+    MathExpression();
+
+    /**
+     * Compiles given expression.
+     *
+     * @param expr expression text
+     * @param numInputs number of input channels, used for validation
+     * @param error if not null set to error message on failure
+     * @return false if expression is invalid
+     */
+    bool compile(const QString& expr, unsigned numInputs, QString* error = nullptr);
+
+    /// Returns true if expression is compiled successfully
+    bool isValid() const;
+
+    /// Returns expression text
+    QString text() const;
+
+    /**
+     * Evaluates the expression for all samples of the pack.
+     *
+     * @param input channel data
+     * @param out array of `input.numSamples()` length
+     */
+    void evaluate(const SamplePack& input, double* out) const;
+
+private:
+    enum class Op : quint8
+    {
+        Channel,
+        Constant,
+        Neg,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Pow,
+        Func1,
+        Func2
+    };
+
+    enum class Func : quint8
+    {
+        None,
+        Sqrt, Abs, Sin, Cos, Tan, Asin, Acos, Atan, Exp, Log, Log10,
+        Floor, Ceil, Round,
+        Atan2, Min, Max
+    };
+
+    struct Instruction
+    {
+        Op op;
+        Func func;
+        unsigned channel;
+        double value;
+    };
+
+    /// Value on the evaluation stack, either an array or a constant
+    struct Operand
+    {
+        const double* data;
+        double value;
+        bool isConst;
+    };
+
+    QString _text;
+    bool _valid;
+    std::vector<Instruction> code;
+    unsigned maxDepth;          ///< maximum stack depth of `code`
+
+    /// Scratch buffers for intermediate results, one per stack depth
+    mutable std::vector<std::vector<double>> regs;
+
+    // recursive descent parser state
+    QString src;
+    int pos;
+    unsigned _numInputs;
+    QString parseError;
+
+    void skipSpaces();
+    bool parseExpr();
+    bool parseTerm();
+    bool parseUnary();
+    bool parsePower();
+    bool parsePrimary();
+    bool fail(QString msg);
+    void emitOp(Op op, Func func = Func::None);
+
+    static Func func1(const QString& name);
+    static Func func2(const QString& name);
+
+    void unary(Op op, Func func, Operand& a, double* out, unsigned n) const;
+    void binary(Op op, Func func, Operand& a, const Operand& b,
+                double* out, unsigned n) const;
+};
+
+#endif // MATHEXPRESSION_H
@@ -0,0 +1,91 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "mathpanel.h"
+#include "ui_mathpanel.h"
+
+#include "setting_defines.h"
+
+MathPanel::MathPanel(MathChannels* math, ChannelInfoModel* infoModel, QWidget *parent) :
+    QWidget(parent),
+    ui(new Ui::MathPanel)
+{
+    _math = math;
+    _infoModel = infoModel;
+    ui->setupUi(this);
+
+    connect(ui->pbApply, &QPushButton::clicked, this, &MathPanel::apply);
+}
+
+MathPanel::~MathPanel()
+{
+    delete ui;
+}
+
+void MathPanel::apply()
+{
+    QStringList exprs;
+    for (auto line : ui->teExpressions->toPlainText().split('\n'))
+    {
+        line = line.trimmed();
+        if (!line.isEmpty()) exprs << line;
+    }
+
+    QStringList errors;
+    _math->setExpressions(exprs, &errors);
+
+    if (errors.isEmpty())
+    {
+        ui->lStatus->setText(exprs.isEmpty() ? "" :
+                             QString("%1 derived channel(s)").arg(exprs.size()));
+    }
+    else
+    {
+        ui->lStatus->setText(errors.join('\n'));
+    }
+
+    // name derived channels after their expressions
+    unsigned start = _math->numInputs();
+    for (int i = 0; i < exprs.size(); i++)
+    {
+        unsigned ci = start + i;
+        if (ci < (unsigned) _infoModel->rowCount())
+        {
+            _infoModel->setData(_infoModel->index(ci, ChannelInfoModel::COLUMN_NAME),
+                                exprs[i], Qt::EditRole);
+        }
+    }
+}
+
+void MathPanel::saveSettings(QSettings* settings)
+{
+    settings->beginGroup(SettingGroup_Math);
+    settings->setValue(SG_Math_Expressions, _math->expressions());
+    settings->endGroup();
+}
+
+void MathPanel::loadSettings(QSettings* settings)
+{
+    settings->beginGroup(SettingGroup_Math);
+    QStringList exprs = settings->value(SG_Math_Expressions).toStringList();
+    settings->endGroup();
+
+    ui->teExpressions->setPlainText(exprs.join('\n'));
+    apply();
+}
@@ -0,0 +1,62 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MATHPANEL_H
+#define MATHPANEL_H
+
+#include <QWidget>
+#include <QSettings>
+
+#include "mathchannels.h"
+#include "channelinfomodel.h"
+
+namespace Ui {
+class MathPanel;
+}
+
+/// Panel for entering derived channel expressions
+class MathPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @param math derived channel calculator
+     * @param infoModel used for naming derived channels, should
+     * belong to the stream that `math` feeds
+     */
+    MathPanel(MathChannels* math, ChannelInfoModel* infoModel, QWidget *parent = 0);
+    ~MathPanel();
+
+    /// Stores settings into a `QSettings`
+    void saveSettings(QSettings* settings);
+    /// Loads settings from a `QSettings`.
+    void loadSettings(QSettings* settings);
+
+private:
+    Ui::MathPanel *ui;
+    MathChannels* _math;
+    ChannelInfoModel* _infoModel;
+
+private slots:
+    /// Applies expressions in the editor
+    void apply();
+};
+
+#endif // MATHPANEL_H
@@ -0,0 +1,279 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <QMutexLocker>
+#include <QVector>
+
+#include "persistenceanalyzer.h"
+
+/// Amount added to a cell for each hit, leaves room for fractions when decaying
+static const quint32 HIT = 1 << 8;
+/// Counts saturate at this value
+static const quint32 MAX_COUNT = UINT32_MAX - HIT;
+
+/// Lives in the worker thread, methods are invoked from analyzer via event queue
+class PersistenceWorker : public QObject
+{
+public:
+    PersistenceWorker(PersistenceAnalyzer::Result* result)
+    {
+        _result = result;
+        width = height = 0;
+    }
+
+    void configure(const PersistenceAnalyzer::Config& config)
+    {
+        _config = config;
+        _config.traceLength = std::max(_config.traceLength, 2u);
+
+        width = std::max(1u, std::min(config.width, _config.traceLength));
+        height = std::max(config.height, 2u);
+        density.assign((size_t) width * height, 0);
+
+        colScale = double(width) / _config.traceLength;
+        double range = config.yMax - config.yMin;
+        rowScale = range > 0 ? (height - 1) / range : 0;
+
+        pos = 0;
+        prevValid = false;
+        numTraces = 0;
+        publish();
+    }
+
+    void addSamples(const QVector<double>& samples)
+    {
+        if (density.empty()) return;
+
+        for (double v : samples)
+        {
+            double row = (v - _config.yMin) * rowScale;
+            row = std::max(0., std::min(row, height - 1.));
+            double col = pos * colScale;
+
+            if (prevValid)
+            {
+                segment(prevCol, prevRow, col, row);
+            }
+            else
+            {
+                span(int(col), row, row);
+            }
+
+            prevCol = col;
+            prevRow = row;
+            prevValid = true;
+
+            if (++pos == _config.traceLength)
+            {
+                // next trace starts from the left, not connected
+                pos = 0;
+                prevValid = false;
+                numTraces++;
+            }
+        }
+
+        publish();
+    }
+
+private:
+    PersistenceAnalyzer::Config _config;
+    PersistenceAnalyzer::Result* _result;
+    std::vector<quint32> density; ///< column major
+    unsigned width, height;
+    double colScale, rowScale;
+    unsigned pos;                 ///< position of next sample in trace
+    bool prevValid;
+    double prevCol, prevRow;
+    unsigned numTraces;           ///< completed traces since last decay
+
+    /// Adds a hit to rows between `r0` and `r1` of a column
+    void span(int col, double r0, double r1)
+    {
+        int lo = lround(std::min(r0, r1));
+        int hi = lround(std::max(r0, r1));
+        quint32* d = &density[(size_t) col * height];
+        // contiguous in column major buffer, vectorizable
+        for (int r = lo; r <= hi; r++)
+        {
+            d[r] = std::min(d[r] + HIT, MAX_COUNT);
+        }
+    }
+
+    /// Rasterizes a line from (`c0`, `r0`) to (`c1`, `r1`) as a span per column
+    void segment(double c0, double r0, double c1, double r1)
+    {
+        int first = c0;
+        int last = c1;
+        if (first == last)
+        {
+            span(first, r0, r1);
+            return;
+        }
+
+        double slope = (r1 - r0) / (c1 - c0);
+        for (int c = first; c <= last; c++)
+        {
+            double a = std::max<double>(c, c0);
+            double b = std::min<double>(c + 1, c1);
+            span(c, r0 + slope * (a - c0), r0 + slope * (b - c0));
+        }
+    }
+
+    /// Scales down all counts for traces completed since last call
+    void decay()
+    {
+        if (numTraces == 0 || _config.decay >= 1) return;
+
+        double f = pow(_config.decay, numTraces);
+        quint64 k = f * 65536;
+        for (auto& d : density)
+        {
+            d = (d * k) >> 16;
+        }
+        numTraces = 0;
+    }
+
+    void publish()
+    {
+        QMutexLocker locker(&_result->mutex);
+
+        // previous result isn't taken yet, keep accumulating
+        if (_result->fresh) return;
+
+        decay();
+        _result->density = density;
+        _result->width = width;
+        _result->height = height;
+        _result->fresh = true;
+    }
+};
+
+PersistenceAnalyzer::PersistenceAnalyzer(QObject* parent) :
+    QObject(parent)
+{
+    _numChannels = 0;
+    processQueued = false;
+
+    worker = new PersistenceWorker(&result);
+    worker->moveToThread(&thread);
+    connect(&thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread.start();
+
+    setConfig(_config);
+}
+
+PersistenceAnalyzer::~PersistenceAnalyzer()
+{
+    thread.quit();
+    thread.wait();
+}
+
+void PersistenceAnalyzer::setConfig(const Config& config)
+{
+    _config = config;
+    {
+        QMutexLocker locker(&result.mutex);
+        result.fresh = false;
+    }
+    {
+        QMutexLocker locker(&pendingMutex);
+        pending.clear();
+    }
+
+    auto w = worker;
+    QMetaObject::invokeMethod(worker, [w, config]() {w->configure(config);});
+}
+
+PersistenceAnalyzer::Config PersistenceAnalyzer::config() const
+{
+    return _config;
+}
+
+unsigned PersistenceAnalyzer::numChannels() const
+{
+    return _numChannels;
+}
+
+bool PersistenceAnalyzer::takeDensity(std::vector<quint32>& out,
+                                      unsigned& width, unsigned& height)
+{
+    QMutexLocker locker(&result.mutex);
+    if (!result.fresh) return false;
+
+    out.swap(result.density);
+    width = result.width;
+    height = result.height;
+    result.fresh = false;
+    return true;
+}
+
+void PersistenceAnalyzer::setNumChannels(unsigned nc, bool x)
+{
+    _numChannels = nc;
+    Sink::setNumChannels(nc, x);
+    emit numChannelsChanged(nc);
+}
+
+void PersistenceAnalyzer::feedIn(const SamplePack& data)
+{
+    if (_config.channel < data.numChannels())
+    {
+        unsigned ns = data.numSamples();
+        const double* src = data.data(_config.channel);
+
+        QMutexLocker locker(&pendingMutex);
+        int oldSize = pending.size();
+        pending.resize(oldSize + ns);
+        std::copy(src, src + ns, pending.begin() + oldSize);
+
+        // drop whole traces so that trace positions stay the same
+        const int traceLength = std::max(_config.traceLength, 2u);
+        const int maxPending = MAX_BACKLOG * traceLength;
+        if (pending.size() > maxPending)
+        {
+            int numDrop = (pending.size() - maxPending + traceLength - 1) / traceLength;
+            pending.remove(0, numDrop * traceLength);
+        }
+
+        // a single invocation takes all packs that arrive until it runs
+        if (!processQueued)
+        {
+            processQueued = true;
+            QMetaObject::invokeMethod(worker, [this]() {processPending();});
+        }
+    }
+
+    Sink::feedIn(data);
+}
+
+void PersistenceAnalyzer::processPending()
+{
+    QVector<double> samples;
+    {
+        QMutexLocker locker(&pendingMutex);
+        samples.swap(pending);
+        processQueued = false;
+    }
+    worker->addSamples(samples);
+}
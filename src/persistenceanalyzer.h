@@ -0,0 +1,119 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef PERSISTENCEANALYZER_H
+#define PERSISTENCEANALYZER_H
+
+#include <vector>
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QVector>
+
+#include "sink.h"
+
+class PersistenceWorker;
+
+/**
+ * Accumulates traces of a channel into a 2D hit count histogram, for
+ * a persistence (digital phosphor) or eye diagram display. Meant to
+ * be connected to `Stream` as a follower.
+ *
+ * Samples are cut into traces of fixed length. Each trace is
+ * rasterized into a column major density buffer in a worker thread,
+ * as vertical spans of hits between consecutive samples. Older hits
+ * decay by a factor per trace. Cost of a sample is independent of how
+ * many traces are accumulated.
+ *
+ * Like `SpectrumAnalyzer` latest result is kept until it's taken with
+ * `takeDensity()`. Incoming packs are merged while the worker is busy,
+ * if it falls behind by more than `MAX_BACKLOG` traces oldest traces
+ * are dropped.
+ */
+class PersistenceAnalyzer : public QObject, public Sink
+{
+    Q_OBJECT
+
+public:
+    /// Maximum number of traces waiting for the worker
+    static const unsigned MAX_BACKLOG = 4;
+
+    struct Config
+    {
+        unsigned channel = 0;
+        unsigned traceLength = 1000; ///< number of samples of a trace
+        double yMin = 0;             ///< value of the bottom row
+        double yMax = 1;             ///< value of the top row
+        double decay = 1;            ///< intensity kept per trace, 1 for infinite
+        unsigned width = 1024;       ///< maximum number of columns
+        unsigned height = 256;       ///< number of rows
+    };
+
+    /// Latest result, shared with the worker thread
+    struct Result
+    {
+        QMutex mutex;
+        std::vector<quint32> density; ///< column major, bottom row first
+        unsigned width = 0;           ///< actual number of columns
+        unsigned height = 0;
+        bool fresh = false;           ///< set when there is a new result
+    };
+
+    explicit PersistenceAnalyzer(QObject* parent = 0);
+    ~PersistenceAnalyzer();
+
+    /// Changes settings. Accumulation is restarted.
+    void setConfig(const Config& config);
+    Config config() const;
+
+    /// Number of channels of the connected stream
+    unsigned numChannels() const;
+
+    /**
+     * Copies latest density to `out` if there is a new one.
+     *
+     * @return false if there is no new density since last call
+     */
+    bool takeDensity(std::vector<quint32>& out, unsigned& width, unsigned& height);
+
+signals:
+    void numChannelsChanged(unsigned value);
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    Config _config;
+    unsigned _numChannels;
+    Result result;
+    QThread thread;
+    PersistenceWorker* worker;
+
+    QMutex pendingMutex;
+    QVector<double> pending;    ///< samples waiting for the worker
+    bool processQueued;         ///< worker is invoked to take `pending`
+
+    /// Gives pending samples to worker, runs in worker thread
+    void processPending();
+};
+
+#endif // PERSISTENCEANALYZER_H
@@ -0,0 +1,181 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+#include <QLabel>
+
+#include "persistenceplot.h"
+
+/// Display update period in milliseconds
+static const int UPDATE_PERIOD = 33;
+
+PersistencePlot::PersistencePlot(Stream* stream, PlotMenu* menu, QWidget* parent) :
+    QWidget(parent)
+{
+    _stream = stream;
+
+    // setup controls
+    spTraceLength.setRange(2, 1000000);
+    spTraceLength.setValue(1000);
+    spTraceLength.setSuffix(" samples");
+    spTraceLength.setKeyboardTracking(false);
+    spTraceLength.setToolTip("Number of samples of a trace");
+
+    cbDecay.addItem("Infinite", 1.);
+    cbDecay.addItem("Long", 0.99);
+    cbDecay.addItem("Short", 0.9);
+    cbDecay.setToolTip("Persistence of older traces");
+
+    for (auto sp : {&spYMin, &spYMax})
+    {
+        sp->setRange(-1e12, 1e12);
+        sp->setDecimals(3);
+        sp->setKeyboardTracking(false);
+    }
+    spYMin.setValue(0);
+    spYMax.setValue(1000);
+    spYMin.setToolTip("Value at the bottom");
+    spYMax.setToolTip("Value at the top");
+
+    pbFit.setText("Fit");
+    pbFit.setToolTip("Set value range from current channel data");
+    pbClear.setText("Clear");
+    pbClear.setToolTip("Clear accumulated traces");
+
+    auto controls = new QHBoxLayout();
+    controls->addWidget(&cbChannel);
+    controls->addWidget(&spTraceLength);
+    controls->addWidget(new QLabel("Persistence:"));
+    controls->addWidget(&cbDecay);
+    controls->addWidget(new QLabel("Range:"));
+    controls->addWidget(&spYMin);
+    controls->addWidget(&spYMax);
+    controls->addWidget(&pbFit);
+    controls->addWidget(&pbClear);
+    controls->addStretch();
+
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addLayout(controls);
+    layout->addWidget(&plot);
+
+    // setup plot
+    plot.setAxisTitle(QwtPlot::xBottom, "Samples");
+    densityItem.attach(&plot);
+
+    // connect to menu
+    connect(&menu->darkBackgroundAction, &QAction::toggled,
+            this, &PersistencePlot::darkBackground);
+    darkBackground(menu->darkBackgroundAction.isChecked());
+
+    connect(&cbChannel, &QComboBox::activated, this, &PersistencePlot::onConfigChanged);
+    connect(&cbDecay, &QComboBox::activated, this, &PersistencePlot::onConfigChanged);
+    connect(&spTraceLength, &QSpinBox::valueChanged, this, &PersistencePlot::onConfigChanged);
+    connect(&spYMin, &QDoubleSpinBox::valueChanged, this, &PersistencePlot::onConfigChanged);
+    connect(&spYMax, &QDoubleSpinBox::valueChanged, this, &PersistencePlot::onConfigChanged);
+    connect(&pbFit, &QPushButton::clicked, this, &PersistencePlot::fitYRange);
+    connect(&pbClear, &QPushButton::clicked, this, &PersistencePlot::onConfigChanged);
+
+    connect(&analyzer, &PersistenceAnalyzer::numChannelsChanged,
+            this, &PersistencePlot::onNumChannelsChanged);
+    _stream->connectFollower(&analyzer);
+
+    connect(&updateTimer, &QTimer::timeout, this, &PersistencePlot::onUpdateTimer);
+    updateTimer.start(UPDATE_PERIOD);
+}
+
+PersistencePlot::~PersistencePlot()
+{
+    _stream->disconnectFollower(&analyzer);
+}
+
+void PersistencePlot::onNumChannelsChanged(unsigned value)
+{
+    int current = cbChannel.currentIndex();
+    cbChannel.clear();
+    for (unsigned ci = 0; ci < value; ci++)
+    {
+        cbChannel.addItem(_stream->channel(ci)->name());
+    }
+    cbChannel.setCurrentIndex(std::max(0, std::min(current, (int) value - 1)));
+    onConfigChanged();
+}
+
+void PersistencePlot::onConfigChanged()
+{
+    PersistenceAnalyzer::Config config;
+    config.channel = std::max(0, cbChannel.currentIndex());
+    config.traceLength = spTraceLength.value();
+    config.decay = cbDecay.currentData().toDouble();
+    config.yMin = spYMin.value();
+    config.yMax = spYMax.value();
+    analyzer.setConfig(config);
+
+    densityItem.clear();
+    densityItem.setRect(QRectF(0, config.yMin,
+                               config.traceLength, config.yMax - config.yMin));
+    plot.setAxisScale(QwtPlot::xBottom, 0, config.traceLength);
+    plot.setAxisScale(QwtPlot::yLeft, config.yMin, config.yMax);
+    plot.replot();
+}
+
+void PersistencePlot::fitYRange()
+{
+    int ci = cbChannel.currentIndex();
+    if (ci < 0 || ci >= (int) _stream->numChannels()) return;
+
+    auto lim = _stream->channel(ci)->yData()->limits();
+    if (lim.start == lim.end)
+    {
+        lim.start -= 0.5;
+        lim.end += 0.5;
+    }
+
+    // update both before config change
+    for (auto sp : {&spYMin, &spYMax}) sp->blockSignals(true);
+    spYMin.setValue(lim.start);
+    spYMax.setValue(lim.end);
+    for (auto sp : {&spYMin, &spYMax}) sp->blockSignals(false);
+    onConfigChanged();
+}
+
+void PersistencePlot::onUpdateTimer()
+{
+    unsigned width, height;
+    if (!isVisible() || !analyzer.takeDensity(density, width, height)) return;
+
+    densityItem.setDensity(density, width, height);
+    plot.replot();
+}
+
+void PersistencePlot::darkBackground(bool enabled)
+{
+    if (enabled)
+    {
+        plot.setCanvasBackground(QBrush(Qt::black));
+    }
+    else
+    {
+        plot.setCanvasBackground(QBrush(Qt::white));
+    }
+    plot.replot();
+}
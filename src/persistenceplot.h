@@ -0,0 +1,78 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef PERSISTENCEPLOT_H
+#define PERSISTENCEPLOT_H
+
+#include <vector>
+#include <QWidget>
+#include <QComboBox>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
+#include <QPushButton>
+#include <QTimer>
+#include <qwt_plot.h>
+
+#include "stream.h"
+#include "plotmenu.h"
+#include "persistenceanalyzer.h"
+#include "densityitem.h"
+
+/// Displays traces of a stream channel accumulated with persistence
+class PersistencePlot : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit PersistencePlot(Stream* stream, PlotMenu* menu, QWidget* parent = 0);
+    ~PersistencePlot();
+
+public slots:
+    /// Enable/disable dark background
+    void darkBackground(bool enabled);
+
+private:
+    Stream* _stream;
+    PersistenceAnalyzer analyzer;
+
+    QComboBox cbChannel;
+    QSpinBox spTraceLength;
+    QComboBox cbDecay;
+    QDoubleSpinBox spYMin;
+    QDoubleSpinBox spYMax;
+    QPushButton pbFit;
+    QPushButton pbClear;
+
+    QwtPlot plot;
+    DensityItem densityItem;
+    std::vector<quint32> density;
+
+    /// Limits display updates to screen frame rate
+    QTimer updateTimer;
+
+private slots:
+    void onNumChannelsChanged(unsigned value);
+    void onConfigChanged();
+    /// Sets Y range to the limits of channel data
+    void fitYRange();
+    void onUpdateTimer();
+};
+
+#endif // PERSISTENCEPLOT_H
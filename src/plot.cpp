@@ -27,6 +27,7 @@
 #include <algorithm>
 
 #include "plot.h"
+#include "lanescaledraw.h"
 
 static const int SYMBOL_SHOW_AT_WIDTH = 5;
 static const int SYMBOL_SIZE_MAX = 7;
@@ -41,6 +42,7 @@ Plot::Plot(QWidget* parent) :
     numOfSamples = 1;
     plotWidth = 1;
     showSymbols = Plot::ShowSymbolsAuto;
+    cacheEnabled = false;
 
     QObject::connect(&zoomer, &Zoomer::unzoomed, this, &Plot::unzoomed);
 
@@ -63,6 +65,9 @@ Plot::Plot(QWidget* parent) :
             [this](QwtPlotItem *plotItem, bool on)
             {
                 if (symbolSize) updateSymbols();
+
+                auto curve = dynamic_cast<FrameBufferCurve*>(plotItem);
+                if (curve != nullptr) curve->setCached(on && cacheEnabled);
             });
 
     // init demo indicator
@@ -96,6 +101,65 @@ void Plot::setDispChannels(QVector<const StreamChannel*> channels)
     zoomer.setDispChannels(channels);
 }
 
+void Plot::replot()
+{
+    curveCache.invalidate();
+    QwtPlot::replot();
+}
+
+void Plot::replotShifted(unsigned numSamples)
+{
+    curveCache.shift(numSamples);
+    QwtPlot::replot();
+}
+
+void Plot::setCurveCache(bool enabled)
+{
+    if (enabled == cacheEnabled) return;
+
+    cacheEnabled = enabled;
+    if (enabled)
+    {
+        curveCache.attach(this);
+    }
+    else
+    {
+        curveCache.detach();
+    }
+
+    for (auto item : itemList(QwtPlotItem::Rtti_PlotCurve))
+    {
+        auto curve = dynamic_cast<FrameBufferCurve*>(item);
+        if (curve != nullptr) curve->setCached(enabled);
+    }
+
+    replot();
+}
+
+std::function<void()> Plot::curveRenderJob()
+{
+    if (!cacheEnabled || !isVisible()) return nullptr;
+
+    auto list = curveCache.curves();
+    for (auto curve : list)
+    {
+        if (curve->symbol() != nullptr) return nullptr;
+    }
+
+    // same maps and rectangle that `replot()` will draw with
+    updateAxes();
+    QwtScaleMap xMap = canvasMap(QwtPlot::xBottom);
+    QwtScaleMap yMap = canvasMap(QwtPlot::yLeft);
+    QRectF rect = canvas()->contentsRect();
+    qreal dpr = canvas()->devicePixelRatioF();
+
+    const CurveCache* cache = &curveCache;
+    return [cache, list, xMap, yMap, rect, dpr]()
+        {
+            cache->render(list, xMap, yMap, rect, dpr);
+        };
+}
+
 void Plot::setYAxis(bool autoScaled, double yAxisMin, double yAxisMax)
 {
     this->isAutoScaled = autoScaled;
@@ -131,10 +195,35 @@ void Plot::setXAxis(double xMin, double xMax)
     onXScaleChanged();
 }
 
+void Plot::setLanes(QStringList names)
+{
+    if (names == laneNames) return;
+
+    laneNames = names;
+    if (laneNames.isEmpty())
+    {
+        setAxisScaleDraw(QwtPlot::yLeft, new QwtScaleDraw());
+        setAxisScaleEngine(QwtPlot::yLeft, new QwtLinearScaleEngine());
+    }
+    else
+    {
+        setAxisScaleDraw(QwtPlot::yLeft, new LaneScaleDraw(laneNames));
+        // a major tick, thus a label, for every lane
+        setAxisScaleEngine(QwtPlot::yLeft, new LaneScaleEngine());
+    }
+
+    zoomer.zoom(0);
+    resetAxes();
+}
+
 void Plot::resetAxes()
 {
     // reset y axis
-    if (isAutoScaled)
+    if (!laneNames.isEmpty())
+    {
+        setAxisScale(QwtPlot::yLeft, -0.5, laneNames.size() - 0.5);
+    }
+    else if (isAutoScaled)
     {
         setAxisAutoScale(QwtPlot::yLeft);
     }
@@ -22,7 +22,9 @@
 
 #include <QColor>
 #include <QList>
+#include <QStringList>
 #include <QAction>
+#include <functional>
 #include <qwt_plot.h>
 #include <qwt_plot_grid.h>
 #include <qwt_plot_shapeitem.h>
@@ -32,6 +34,7 @@
 #include "zoomer.h"
 #include "scalezoomer.h"
 #include "plotsnapshotoverlay.h"
+#include "curvecache.h"
 
 class Plot : public QwtPlot
 {
@@ -65,6 +68,12 @@ public slots:
     void setXAxis(double xMin, double xMax);
     void setSymbols(ShowSymbols shown);
     void setLegendPosition(Qt::AlignmentFlag alignment);
+    /**
+     * Shows a lane for each name on the Y axis, first one at the
+     * top. Lane `i` of `n` is centered at `n-1-i`. An empty list
+     * returns to regular Y axis.
+     */
+    void setLanes(QStringList names);
 
     /**
      * Displays an animation for snapshot.
@@ -77,6 +86,23 @@ public slots:
 
     void setPlotWidth(double width);
 
+    /// Redraws everything
+    void replot() override;
+    /**
+     * Replots after curve data moved left by `numSamples`, redrawing
+     * only the new part of the curves if curve cache is enabled.
+     */
+    void replotShifted(unsigned numSamples);
+    /// Paint curves through a `CurveCache`
+    void setCurveCache(bool enabled);
+    /**
+     * Returns a function that brings curve cache up to date for the
+     * next replot. It can be run in a worker thread. Returns an empty
+     * function if cache is disabled or curves should be rendered in
+     * GUI thread.
+     */
+    std::function<void()> curveRenderJob();
+
 protected:
     /// update the display of symbols depending on `symbolSize`
     void updateSymbols();
@@ -84,6 +110,7 @@ protected:
 private:
     bool isAutoScaled;
     double yMin, yMax;
+    QStringList laneNames;
     double _xMin, _xMax;
     unsigned numOfSamples;
     double plotWidth;
@@ -96,6 +123,8 @@ private:
     QwtPlotTextLabel demoIndicator;
     QwtPlotTextLabel noChannelIndicator;
     ShowSymbols showSymbols;
+    bool cacheEnabled;
+    CurveCache curveCache;
 
     void resetAxes();
     void resizeEvent(QResizeEvent * event);
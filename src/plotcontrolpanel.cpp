@@ -22,6 +22,7 @@
 #include <QCheckBox>
 #include <QStyledItemDelegate>
 #include <QColorDialog>
+#include <QScreen>
 
 #include <math.h>
 
@@ -142,6 +143,21 @@ PlotControlPanel::PlotControlPanel(QWidget *parent) :
                 emit lineThicknessChanged(thickness);
             });
 
+    connect(ui->cbCompressBuffer, &QCheckBox::toggled,
+            this, &PlotControlPanel::compressBufferChanged);
+
+    connect(ui->cbStats, &QComboBox::currentIndexChanged,
+            this, &PlotControlPanel::statsModeChanged);
+
+    connect(ui->cbIncremental, &QCheckBox::toggled,
+            this, &PlotControlPanel::incrementalChanged);
+
+    connect(ui->cbMaxFps, &QComboBox::currentIndexChanged,
+            [this]()
+            {
+                emit maxFpsChanged(maxFps());
+            });
+
     // init scale range preset list
     for (int nbits = 8; nbits <= 24; nbits++) // signed binary formats
     {
@@ -316,6 +332,40 @@ double PlotControlPanel::yMin() const
     return ui->spYmin->value();
 }
 
+bool PlotControlPanel::compressBuffer() const
+{
+    return ui->cbCompressBuffer->isChecked();
+}
+
+int PlotControlPanel::statsMode() const
+{
+    return ui->cbStats->currentIndex();
+}
+
+bool PlotControlPanel::incremental() const
+{
+    return ui->cbIncremental->isChecked();
+}
+
+unsigned PlotControlPanel::maxFps() const
+{
+    const QString text = ui->cbMaxFps->currentText();
+    if (text == "Unlimited")
+    {
+        return 0;
+    }
+    else if (text == "Display")
+    {
+        auto screen = window()->screen();
+        qreal rate = screen != nullptr ? screen->refreshRate() : 60;
+        return rate >= 1 ? qRound(rate) : 60;
+    }
+    else
+    {
+        return text.toUInt();
+    }
+}
+
 bool PlotControlPanel::xAxisAsIndex() const
 {
     return ui->cbIndex->isChecked();
@@ -460,6 +510,10 @@ void PlotControlPanel::saveSettings(QSettings* settings)
     settings->setValue(SG_Plot_YMax, yMax());
     settings->setValue(SG_Plot_YMin, yMin());
     settings->setValue(SG_Plot_LineThickness, ui->spLineThickness->value());
+    settings->setValue(SG_Plot_CompressBuffer, compressBuffer());
+    settings->setValue(SG_Plot_Stats, statsMode());
+    settings->setValue(SG_Plot_MaxFps, ui->cbMaxFps->currentText());
+    settings->setValue(SG_Plot_Incremental, incremental());
     settings->endGroup();
 }
 
@@ -480,5 +534,14 @@ void PlotControlPanel::loadSettings(QSettings* settings)
     ui->spYmin->setValue(settings->value(SG_Plot_YMin, yMin()).toDouble());
     ui->spLineThickness->setValue(
         settings->value(SG_Plot_LineThickness, ui->spLineThickness->value()).toInt());
+    ui->cbCompressBuffer->setChecked(
+        settings->value(SG_Plot_CompressBuffer, compressBuffer()).toBool());
+    ui->cbStats->setCurrentIndex(
+        settings->value(SG_Plot_Stats, statsMode()).toInt());
+    int fpsIndex = ui->cbMaxFps->findText(
+        settings->value(SG_Plot_MaxFps, ui->cbMaxFps->currentText()).toString());
+    if (fpsIndex >= 0) ui->cbMaxFps->setCurrentIndex(fpsIndex);
+    ui->cbIncremental->setChecked(
+        settings->value(SG_Plot_Incremental, incremental()).toBool());
     settings->endGroup();
 }
@@ -44,6 +44,12 @@ public:
     bool   autoScale() const;
     double yMax() const;
     double yMin() const;
+    bool   compressBuffer() const;
+    /// Returns selected statistics mode, see `ChannelStats::Mode`
+    int    statsMode() const;
+    /// Returns selected plot frame rate limit, 0 means unlimited
+    unsigned maxFps() const;
+    bool   incremental() const;
     bool   xAxisAsIndex() const;
     double xMax() const;
     double xMin() const;
@@ -63,6 +69,10 @@ signals:
     void xScaleChanged(bool asIndex, double xMin = 0, double xMax = 1);
     void plotWidthChanged(double width);
     void lineThicknessChanged(int thickness);
+    void compressBufferChanged(bool enabled);
+    void statsModeChanged(int mode);
+    void maxFpsChanged(unsigned fps);
+    void incrementalChanged(bool enabled);
 
 private:
     Ui::PlotControlPanel *ui;
@@ -48,7 +48,8 @@ PlotManager::PlotManager(QWidget* plotArea, PlotMenu* menu,
             });
 
     connect(stream, &Stream::numChannelsChanged, this, &PlotManager::onNumChannelsChanged);
-    connect(stream, &Stream::dataAdded, this, &PlotManager::replot);
+    connect(stream, &Stream::dataAdded, this, &PlotManager::requestReplot);
+    connect(stream, &Stream::channelBuffersChanged, this, &PlotManager::onChannelBuffersChanged);
 
     // add initial curves if any?
     for (unsigned int i = 0; i < stream->numChannels(); i++)
@@ -84,6 +85,11 @@ void PlotManager::construct(QWidget* plotArea, PlotMenu* menu)
 {
     _menu = menu;
     _plotArea = plotArea;
+    _trigger = nullptr;
+    _scheduler = nullptr;
+    replotPending = false;
+    _incremental = false;
+    lastTotalSamples = 0;
     _autoScaled = true;
     _yMin = 0;
     _yMax = 1;
@@ -98,6 +104,7 @@ void PlotManager::construct(QWidget* plotArea, PlotMenu* menu)
 
     // initalize layout and single widget
     isMulti = false;
+    isLanes = menu->showLanesAction.isChecked();
     scrollArea = NULL;
 
     // connect to  menu
@@ -111,6 +118,8 @@ void PlotManager::construct(QWidget* plotArea, PlotMenu* menu)
             this, &PlotManager::darkBackground);
     connect(&menu->showMultiAction, &QAction::toggled,
             this, &PlotManager::setMulti);
+    connect(&menu->showLanesAction, &QAction::toggled,
+            this, &PlotManager::setLanes);
     connect(&menu->unzoomAction, &QAction::triggered,
             this, &PlotManager::unzoom);
 
@@ -154,7 +163,7 @@ void PlotManager::onNumChannelsChanged(unsigned value)
         // add new channels
         for (unsigned int i = oldNum; i < numOfChannels; i++)
         {
-            addCurve(_stream->channel(i)->name(), _stream->channel(i)->xData(), _stream->channel(i)->yData());
+            addCurve(_stream->channel(i)->name(), _stream->channel(i)->xData(), yData(i));
         }
     }
     else if(numOfChannels < oldNum)
@@ -165,10 +174,62 @@ void PlotManager::onNumChannelsChanged(unsigned value)
     replot();
 }
 
+void PlotManager::onChannelBuffersChanged()
+{
+    int ci = 0;
+    for (auto curve : curves)
+    {
+        FrameBufferSeries* series = static_cast<FrameBufferSeries*>(curve->data());
+        series->setY(yData(ci));
+        ci++;
+    }
+    replot();
+}
+
+const FrameBuffer* PlotManager::yData(unsigned channel) const
+{
+    // trigger is updated after the stream when number of channels change
+    if (_trigger != nullptr && channel < _trigger->numChannels())
+    {
+        return _trigger->displayData(channel);
+    }
+    return _stream->channel(channel)->yData();
+}
+
+void PlotManager::setTriggerCapture(const TriggerCapture* capture)
+{
+    Q_ASSERT(_stream != nullptr);
+
+    if (_trigger != nullptr)
+    {
+        disconnect(_trigger, nullptr, this, nullptr);
+    }
+    _trigger = capture;
+
+    // when triggered only captures are plotted, no need to replot for each data
+    if (_trigger != nullptr)
+    {
+        disconnect(_stream, &Stream::dataAdded, this, &PlotManager::requestReplot);
+        connect(_trigger, &TriggerCapture::captured, this, &PlotManager::requestReplot);
+        connect(_trigger, &TriggerCapture::numChannelsChanged,
+                this, &PlotManager::onChannelBuffersChanged);
+    }
+    else
+    {
+        connect(_stream, &Stream::dataAdded, this, &PlotManager::requestReplot,
+                Qt::UniqueConnection);
+    }
+
+    onChannelBuffersChanged();
+}
+
 void PlotManager::onChannelInfoChanged(const QModelIndex &topLeft,
                                        const QModelIndex &bottomRight,
                                        const QVector<int> &roles)
 {
+    // statistics updates don't concern the plot
+    if (topLeft.column() >= ChannelInfoModel::COLUMN_MEAN) return;
+
     int start = topLeft.row();
     int end = bottomRight.row();
 
@@ -202,6 +263,7 @@ void PlotManager::onChannelInfoChanged(const QModelIndex &topLeft,
     // replot single widget
     if (!isMulti)
     {
+        updateLanes();
         plotWidgets[0]->updateSymbols();
         plotWidgets[0]->updateLegend();
         replot();
@@ -274,6 +336,7 @@ void PlotManager::setMulti(bool enabled)
         }
     }
 
+    updateLanes();
 
     // Note: direct call doesn't work presumably because widgets are not ready
     QMetaObject::invokeMethod(this, "syncScales", Qt::QueuedConnection);
@@ -323,6 +386,46 @@ void PlotManager::setupLayout(bool multiPlot)
     layout->setSpacing(1);
 }
 
+void PlotManager::setLanes(bool enabled)
+{
+    isLanes = enabled;
+    updateLanes();
+    replot();
+}
+
+void PlotManager::updateLanes()
+{
+    if (plotWidgets.isEmpty()) return;
+
+    // lanes are only displayed in single plot
+    bool enabled = isLanes && !isMulti;
+    unsigned numLanes = 0;
+    if (enabled)
+    {
+        numLanes = std::count_if(curves.cbegin(), curves.cend(),
+                                 [](QwtPlotCurve* c) {return c->isVisible();});
+    }
+
+    QStringList names;
+    for (auto curve : curves)
+    {
+        auto fbCurve = static_cast<FrameBufferCurve*>(curve);
+        if (enabled && curve->isVisible())
+        {
+            // first lane is at the top
+            double center = numLanes - 1 - names.size();
+            fbCurve->setLane(center - 0.5, center + 0.5, _autoScaled, _yMin, _yMax);
+            names << curve->title().text();
+        }
+        else
+        {
+            fbCurve->clearLane();
+        }
+    }
+
+    if (!isMulti) plotWidgets[0]->setLanes(names);
+}
+
 Plot* PlotManager::addPlotWidget()
 {
     auto plot = new Plot();
@@ -337,6 +440,7 @@ Plot* PlotManager::addPlotWidget()
     plot->setSymbols(_menu->showSymbols());
 
     plot->showDemoIndicator(isDemoShown);
+    plot->setCurveCache(_incremental || isMulti);
     plot->setYAxis(_autoScaled, _yMin, _yMax);
     plot->setNumOfSamples(_numOfSamples);
 
@@ -368,12 +472,14 @@ void PlotManager::syncScales()
 
     // find maximum extent
     double maxExtent = 0;
+    QVector<double> oldExtents;
     for (auto plot : plotWidgets)
     {
-        if (!plot->isVisible()) continue;
-
         QwtScaleWidget* scaleWidget = plot->axisWidget(QwtPlot::yLeft);
         QwtScaleDraw* scaleDraw = scaleWidget->scaleDraw();
+        oldExtents.append(scaleDraw->minimumExtent());
+        if (!plot->isVisible()) continue;
+
         scaleDraw->setMinimumExtent(0);
 
         const double extent = scaleDraw->extent(scaleWidget->font());
@@ -381,17 +487,15 @@ void PlotManager::syncScales()
             maxExtent = extent;
     }
 
-    // apply maximum extent
-    for (auto plot : plotWidgets)
+    // apply maximum extent, only changed plots need a replot
+    for (int i = 0; i < plotWidgets.size(); i++)
     {
-        QwtScaleWidget* scaleWidget = plot->axisWidget(QwtPlot::yLeft);
+        QwtScaleWidget* scaleWidget = plotWidgets[i]->axisWidget(QwtPlot::yLeft);
         scaleWidget->scaleDraw()->setMinimumExtent(maxExtent);
-        scaleWidget->updateGeometry();
-    }
+        if (oldExtents[i] == maxExtent) continue;
 
-    for (auto plot : plotWidgets)
-    {
-        plot->replot();
+        scaleWidget->updateGeometry();
+        plotWidgets[i]->replot();
     }
 
     inScaleSync = false;
@@ -399,10 +503,7 @@ void PlotManager::syncScales()
 
 void PlotManager::addCurve(QString title, const XFrameBuffer* xBuf, const FrameBuffer* yBuf)
 {
-    auto curve = new QwtPlotCurve(title);
-    auto series = new FrameBufferSeries(xBuf, yBuf);
-    curve->setSamples(series);
-    _addCurve(curve);
+    _addCurve(new FrameBufferCurve(title, xBuf, yBuf));
 }
 
 void PlotManager::_addCurve(QwtPlotCurve* curve)
@@ -442,6 +543,7 @@ void PlotManager::_addCurve(QwtPlotCurve* curve)
 
     // show the curve
     curve->attach(plot);
+    updateLanes();
     checkNoVisChannels();
     plot->replot();
 }
@@ -469,6 +571,7 @@ void PlotManager::removeCurves(unsigned number)
             }
         }
     }
+    updateLanes();
 }
 
 unsigned PlotManager::numOfCurves()
@@ -490,11 +593,112 @@ Plot* PlotManager::plotWidget(unsigned curveIndex)
 
 void PlotManager::replot()
 {
+    replotPending = false;
+    if (_stream != nullptr) lastTotalSamples = _stream->totalSamples();
+
+    if (isMulti)
+    {
+        for (auto plot : plotWidgets)
+        {
+            plot->curveCache.invalidate();
+        }
+        renderCurves();
+        for (auto plot : plotWidgets)
+        {
+            plot->replotShifted(0);
+        }
+        syncScales();
+    }
+    else
+    {
+        for (auto plot : plotWidgets)
+        {
+            plot->replot();
+        }
+    }
+}
+
+void PlotManager::renderCurves()
+{
+    if (plotWidgets.size() < 2) return;
+
+    for (auto plot : plotWidgets)
+    {
+        auto job = plot->curveRenderJob();
+        if (job) renderPool.start(job);
+    }
+    renderPool.waitForDone();
+}
+
+void PlotManager::setReplotScheduler(ReplotScheduler* scheduler)
+{
+    if (_scheduler != nullptr)
+    {
+        disconnect(_scheduler, nullptr, this, nullptr);
+    }
+    _scheduler = scheduler;
+
+    if (_scheduler != nullptr)
+    {
+        connect(_scheduler, &ReplotScheduler::frame, this, &PlotManager::onFrame);
+    }
+
+    // don't leave a pending replot behind
+    if (replotPending) replot();
+}
+
+void PlotManager::requestReplot()
+{
+    if (_scheduler == nullptr)
+    {
+        replotPending = true;
+        onFrame();
+    }
+    else
+    {
+        replotPending = true;
+        _scheduler->schedule();
+    }
+}
+
+void PlotManager::onFrame()
+{
+    if (!replotPending) return;
+
+    // trigger captures replace the data instead of scrolling it, and
+    // auto scaled lanes change their scale with data
+    if (!_incremental || _stream == nullptr || _trigger != nullptr ||
+        (isLanes && !isMulti && _autoScaled))
+    {
+        replot();
+        return;
+    }
+
+    quint64 total = _stream->totalSamples();
+    unsigned shift = std::min<quint64>(total - lastTotalSamples, _numOfSamples);
+    lastTotalSamples = total;
+    replotPending = false;
+
+    for (auto plot : plotWidgets)
+    {
+        plot->curveCache.shift(shift);
+    }
+    renderCurves();
+
+    // note: if Y scales change `syncScales` is called via `scaleDivChanged`
+    for (auto plot : plotWidgets)
+    {
+        plot->replotShifted(0);
+    }
+}
+
+void PlotManager::setIncremental(bool enabled)
+{
+    _incremental = enabled;
     for (auto plot : plotWidgets)
     {
-        plot->replot();
+        plot->setCurveCache(_incremental || isMulti);
     }
-    if (isMulti) syncScales();
 }
 
 void PlotManager::showGrid(bool show)
@@ -568,6 +772,7 @@ void PlotManager::setYAxis(bool autoScaled, double yAxisMin, double yAxisMax)
     _autoScaled = autoScaled;
     _yMin = yAxisMin;
     _yMax = yAxisMax;
+    updateLanes();
     for (auto plot : plotWidgets)
     {
         plot->setYAxis(autoScaled, yAxisMin, yAxisMax);
@@ -27,11 +27,15 @@
 #include <QList>
 #include <QSettings>
 #include <QMenu>
+#include <QThreadPool>
 
 #include <qwt_plot_curve.h>
 #include "plot.h"
 #include "framebufferseries.h"
+#include "framebuffercurve.h"
 #include "stream.h"
+#include "triggercapture.h"
+#include "replotscheduler.h"
 #include "snapshot.h"
 #include "plotmenu.h"
 
@@ -59,6 +63,8 @@ public:
 public slots:
     /// Enable/Disable multiple plot display
     void setMulti(bool enabled);
+    /// Enable/Disable display of channels in stacked lanes of a single plot
+    void setLanes(bool enabled);
     /// Update all plot widgets
     void replot();
     /// Enable display of a "DEMO" label on each plot
@@ -75,9 +81,17 @@ public slots:
     void setPlotWidth(double width);
     /// Set curve line thickness
     void setLineThickness(int thickness);
+    /// Display captured data of a trigger instead of stream data, `nullptr` to disable
+    void setTriggerCapture(const TriggerCapture* capture);
+    /// Replot new data at the frame rate of `scheduler` instead of
+    /// immediately, `nullptr` to disable
+    void setReplotScheduler(ReplotScheduler* scheduler);
+    /// Enable drawing only the new parts of curves as data scrolls
+    void setIncremental(bool enabled);
 
 private:
     bool isMulti;
+    bool isLanes;
     QWidget* _plotArea;
     PlotMenu* _menu;
     QVBoxLayout* layout; ///< layout of the `plotArea`
@@ -86,6 +100,12 @@ private:
     QList<Plot*> plotWidgets;
     Plot* emptyPlot;  ///< for displaying when all channels are hidden
     const Stream* _stream;       ///< attached stream, can be `nullptr`
+    const TriggerCapture* _trigger; ///< displayed trigger, can be `nullptr`
+    ReplotScheduler* _scheduler; ///< can be `nullptr`
+    bool replotPending;          ///< new data waiting for a frame
+    bool _incremental;
+    quint64 lastTotalSamples;    ///< stream sample count at last replot
+    QThreadPool renderPool;      ///< for rendering plots in parallel
     const ChannelInfoModel* infoModel;
     bool isDemoShown;
     bool _autoScaled;
@@ -112,6 +132,12 @@ private:
     void _addCurve(QwtPlotCurve* curve);
     /// Check and make sure "no visible channels" text is shown
     void checkNoVisChannels();
+    /// Assigns lanes to visible curves if lanes display is enabled
+    void updateLanes();
+    /// Renders curves of multiple plots in parallel, before replot
+    void renderCurves();
+    /// Returns the displayed Y data of a stream channel
+    const FrameBuffer* yData(unsigned channel) const;
 
 private slots:
     void showGrid(bool show = true);
@@ -122,7 +148,11 @@ private slots:
     void darkBackground(bool enabled = true);
     void setSymbols(Plot::ShowSymbols shown);
 
+    /// Replots now or at the next frame of the scheduler
+    void requestReplot();
+    void onFrame();
     void onNumChannelsChanged(unsigned value);
+    void onChannelBuffersChanged();
     void onChannelInfoChanged(const QModelIndex & topLeft,
                               const QModelIndex & bottomRight,
                               const QVector<int> & roles = QVector<int> ());
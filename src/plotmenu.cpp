@@ -31,6 +31,7 @@ PlotMenu::PlotMenu(QWidget* parent) :
     darkBackgroundAction("&Dark Background", this),
     showLegendAction("&Legend", this),
     showMultiAction("Multi &Plot", this),
+    showLanesAction("L&anes", this),
     setSymbolsAction("&Symbols", this),
     setSymbolsAutoAct("Show When &Zoomed", this),
     setSymbolsShowAct("Always &Show", this),
@@ -48,6 +49,7 @@ PlotMenu::PlotMenu(QWidget* parent) :
     darkBackgroundAction.setToolTip("Enable Dark Plot Background");
     showLegendAction.setToolTip("Display the Legend on Plot");
     showMultiAction.setToolTip("Display All Channels Separately");
+    showLanesAction.setToolTip("Display All Channels Stacked in a Single Plot");
     setSymbolsAction.setToolTip("Show/Hide symbols");
 
     showGridAction.setShortcut(QKeySequence("G"));
@@ -58,12 +60,26 @@ PlotMenu::PlotMenu(QWidget* parent) :
     darkBackgroundAction.setCheckable(true);
     showLegendAction.setCheckable(true);
     showMultiAction.setCheckable(true);
+    showLanesAction.setCheckable(true);
 
     showGridAction.setChecked(false);
     showMinorGridAction.setChecked(false);
     darkBackgroundAction.setChecked(false);
     showLegendAction.setChecked(true);
     showMultiAction.setChecked(false);
+    showLanesAction.setChecked(false);
+
+    // multi plot and lanes are exclusive, but both can be off
+    connect(&showMultiAction, &QAction::toggled,
+            [this](bool checked)
+            {
+                if (checked) showLanesAction.setChecked(false);
+            });
+    connect(&showLanesAction, &QAction::toggled,
+            [this](bool checked)
+            {
+                if (checked) showMultiAction.setChecked(false);
+            });
 
     // minor grid is only enabled when _major_ grid is enabled
     showMinorGridAction.setEnabled(false);
@@ -143,6 +159,7 @@ PlotMenu::PlotMenu(QWidget* parent) :
     addAction(&showLegendAction);
     addAction(&setLegendPosAction);
     addAction(&showMultiAction);
+    addAction(&showLanesAction);
     addAction(&setSymbolsAction);
 }
 
@@ -154,6 +171,7 @@ PlotMenu::PlotMenu(PlotViewSettings s, QWidget* parent) :
     darkBackgroundAction.setChecked(s.darkBackground);
     showLegendAction.setChecked(s.showLegend);
     showMultiAction.setChecked(s.showMulti);
+    showLanesAction.setChecked(s.showLanes);
     switch (s.showSymbols)
     {
         case Plot::ShowSymbolsAuto:
@@ -177,6 +195,7 @@ PlotViewSettings PlotMenu::viewSettings() const
             darkBackgroundAction.isChecked(),
             showLegendAction.isChecked(),
             showMultiAction.isChecked(),
+            showLanesAction.isChecked(),
             showSymbols()
         });
 }
@@ -210,6 +229,7 @@ void PlotMenu::saveSettings(QSettings* settings)
     settings->setValue(SG_Plot_MinorGrid, showMinorGridAction.isChecked());
     settings->setValue(SG_Plot_Legend, showLegendAction.isChecked());
     settings->setValue(SG_Plot_MultiPlot, showMultiAction.isChecked());
+    settings->setValue(SG_Plot_Lanes, showLanesAction.isChecked());
 
     // save symbol option
     QString showSymbolsStr;
@@ -264,6 +284,8 @@ void PlotMenu::loadSettings(QSettings* settings)
         settings->value(SG_Plot_Legend, showLegendAction.isChecked()).toBool());
     showMultiAction.setChecked(
         settings->value(SG_Plot_MultiPlot, showMultiAction.isChecked()).toBool());
+    showLanesAction.setChecked(
+        settings->value(SG_Plot_Lanes, showLanesAction.isChecked()).toBool());
 
     // load symbol option
     QString showSymbolsStr = settings->value(SG_Plot_Symbols, QString()).toString();
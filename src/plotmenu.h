@@ -35,6 +35,7 @@ struct PlotViewSettings
     bool darkBackground;
     bool showLegend;
     bool showMulti;
+    bool showLanes;
     Plot::ShowSymbols showSymbols;
 };
 
@@ -52,6 +53,7 @@ public:
     QAction darkBackgroundAction;
     QAction showLegendAction;
     QAction showMultiAction;
+    QAction showLanesAction;
 
     /// Returns a bundle of current view settings (menu selections)
     PlotViewSettings viewSettings() const;
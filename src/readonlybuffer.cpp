@@ -82,6 +82,19 @@ Range ReadOnlyBuffer::limits() const
     return _limits;
 }
 
+Range ReadOnlyBuffer::rangeLimits(unsigned start, unsigned end) const
+{
+    Q_ASSERT(start < end && end <= _size);
+
+    Range r = {data[start], data[start]};
+    for (unsigned i = start + 1; i < end; i++)
+    {
+        if (data[i] < r.start) r.start = data[i];
+        else if (data[i] > r.end) r.end = data[i];
+    }
+    return r;
+}
+
 void ReadOnlyBuffer::updateLimits()
 {
     Q_ASSERT(_size);
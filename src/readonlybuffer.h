@@ -49,6 +49,7 @@ public:
     virtual unsigned size() const;
     virtual double sample(unsigned i) const;
     virtual Range limits() const;
+    virtual Range rangeLimits(unsigned start, unsigned end) const;
 
 private:
     double* data;    ///< data storage
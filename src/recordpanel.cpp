@@ -28,6 +28,7 @@
 #include <QFileSystemModel>
 #include <QtDebug>
 #include <ctime>
+#include <algorithm>
 
 #include "recordpanel.h"
 #include "ui_recordpanel.h"
@@ -38,10 +39,15 @@ RecordPanel::RecordPanel(Stream* stream, QWidget *parent) :
     ui(new Ui::RecordPanel),
     recordToolBar(tr("Record Toolbar")),
     recordAction(QIcon::fromTheme("media-record"), tr("Record"), this),
-    recorder(this)
+    recorder(this),
+    // plotting shouldn't be blocked by a slow disk, drops are displayed
+    asyncRecorder(ASYNC_QUEUE_SIZE, AsyncSink::DropNewest)
 {
     overwriteSelected = false;
     _stream = stream;
+    recordSink = nullptr;
+    lastCompressedBytes = 0;
+    asyncRecorder.connectFollower(&recorder);
 
     ui->setupUi(this);
 
@@ -78,10 +84,30 @@ RecordPanel::RecordPanel(Stream* stream, QWidget *parent) :
             });
 
 
+    // recorder is fed from the background thread, options can't change during recording
+    connect(&recordAction, &QAction::toggled, ui->cbDisableBuffering, &QWidget::setDisabled);
     connect(&recordAction, &QAction::toggled, ui->cbWindowsLE, &QWidget::setDisabled);
     connect(&recordAction, &QAction::toggled, ui->cbTimestamp, &QWidget::setDisabled);
     connect(&recordAction, &QAction::toggled, ui->leSeparator, &QWidget::setDisabled);
     connect(&recordAction, &QAction::toggled, ui->pbBrowse, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->cbDecimation, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->cbBackground, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->spDecimationFactor, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->cbFormat, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->cbCompression, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->spSyncInterval, &QWidget::setDisabled);
+    connect(&recordAction, &QAction::toggled, ui->spSyncSize, &QWidget::setDisabled);
+    // after above connections, so that CSV options stay disabled for binary formats
+    connect(&recordAction, &QAction::toggled, this, &RecordPanel::updateFormatOptions);
+    connect(ui->cbFormat, &QComboBox::currentIndexChanged,
+            this, &RecordPanel::updateFormatOptions);
+
+    statsTimer.setInterval(STATS_UPDATE_PERIOD);
+    connect(&statsTimer, &QTimer::timeout, this, &RecordPanel::updateStats);
+    connect(&idleSyncTimer, &QTimer::timeout, this, [this]()
+            {
+                recorder.syncIfDue();
+            });
 
     QCompleter *completer = new QCompleter(this);
     auto fileSystemModel = new QFileSystemModel(completer);
@@ -101,6 +127,8 @@ RecordPanel::RecordPanel(Stream* stream, QWidget *parent) :
 
 RecordPanel::~RecordPanel()
 {
+    // background writer must be stopped before it's destroyed
+    if (recordSink != nullptr) stopRecording();
     delete ui;
 }
 
@@ -203,7 +231,7 @@ void RecordPanel::onRecord(bool start)
     }
 
     bool canceled = false;
-    if (ui->leSeparator->text().isEmpty())
+    if (currentFormat() == DataRecorder::Format::csv && ui->leSeparator->text().isEmpty())
     {
         QMessageBox::critical(this, "Error",
                               "Column separator cannot be empty! Please select a separator.");
@@ -311,14 +339,62 @@ bool RecordPanel::startRecording(QString fileName)
 {
     QStringList channelNames;
 
-    if (ui->cbHeader->isChecked())
+    // binary recording always has a header
+    if (ui->cbHeader->isChecked() || currentFormat() != DataRecorder::Format::csv)
     {
         channelNames = _stream->infoModel()->channelNames();
     }
 
+    recorder.setDecimation((Decimator::Mode) ui->cbDecimation->currentIndex(),
+                           ui->spDecimationFactor->value());
+    recorder.setFormat(currentFormat());
+    recorder.setCompression(compressionSelected());
+    // background writer timestamps packs when they arrive, not when they are written
+    if (ui->cbBackground->isChecked())
+    {
+        recorder.setTimeSource([this]() {return asyncRecorder.packTime();});
+    }
+    else
+    {
+        recorder.setTimeSource({});
+    }
+    recorder.setSyncPolicy(ui->spSyncInterval->value(),
+                           qint64(ui->spSyncSize->value()) * 1024 * 1024);
+
     if (recorder.startRecording(fileName, getSeparator(), channelNames, currentTimestampOption()))
     {
-        _stream->connectFollower(&recorder);
+        // sync the last written data when stream stops, on the writer thread
+        int idleSyncPeriod = std::max(1, ui->spSyncInterval->value() / 2);
+        if (ui->cbBackground->isChecked())
+        {
+            asyncRecorder.resetStats();
+            recordSink = &asyncRecorder;
+            if (ui->spSyncInterval->value())
+            {
+                asyncRecorder.setIdleHandler(idleSyncPeriod, [this]()
+                                             {
+                                                 recorder.syncIfDue();
+                                             });
+            }
+        }
+        else
+        {
+            recordSink = &recorder;
+            if (ui->spSyncInterval->value())
+            {
+                idleSyncTimer.start(idleSyncPeriod);
+            }
+        }
+        ui->lBacklog->clear();
+        ui->lCompression->clear();
+        lastCompressedBytes = recorder.compressedBytes();
+        compressionTimer.start();
+        updateStats();
+        if (recordSink == &asyncRecorder || compressionSelected())
+        {
+            statsTimer.start();
+        }
+        _stream->connectFollower(recordSink);
         return true;
     }
     else
@@ -329,8 +405,31 @@ bool RecordPanel::startRecording(QString fileName)
 
 void RecordPanel::stopRecording(void)
 {
+    _stream->disconnectFollower(recordSink);
+    statsTimer.stop();
+    idleSyncTimer.stop();
+    if (recordSink == &asyncRecorder)
+    {
+        // write remaining data before closing the file
+        asyncRecorder.flush();
+        asyncRecorder.setIdleHandler(0, {});
+        updateBacklog();
+        if (asyncRecorder.numDropped())
+        {
+            qWarning() << "Background recording dropped" << asyncRecorder.numDropped()
+                       << "packs because writing was too slow";
+        }
+    }
+    recordSink = nullptr;
     recorder.stopRecording();
-    _stream->disconnectFollower(&recorder);
+
+    if (compressionSelected() && recorder.uncompressedBytes())
+    {
+        double ratio = 100. * recorder.compressedBytes() / recorder.uncompressedBytes();
+        ui->lCompression->setText(tr("Compressed: %1 MB, %2% of original")
+                                  .arg(recorder.compressedBytes() / 1e6, 0, 'f', 1)
+                                  .arg(ratio, 0, 'f', 1));
+    }
 }
 
 void RecordPanel::onPortClose()
@@ -361,6 +460,64 @@ DataRecorder::TimestampOption RecordPanel::currentTimestampOption() const
     }
 }
 
+void RecordPanel::updateStats()
+{
+    if (recordSink == &asyncRecorder) updateBacklog();
+    if (compressionSelected()) updateCompression();
+}
+
+void RecordPanel::updateBacklog()
+{
+    auto dropped = asyncRecorder.numDropped();
+    QString text = tr("Backlog: %1").arg(asyncRecorder.queueDepth());
+    if (dropped)
+    {
+        text += " <span style=\"color:red\">" + tr("Dropped: %1").arg(dropped) + "</span>";
+    }
+    ui->lBacklog->setText(text);
+}
+
+void RecordPanel::updateCompression()
+{
+    qint64 compressed = recorder.compressedBytes();
+    qint64 uncompressed = recorder.uncompressedBytes();
+    double elapsed = compressionTimer.restart() / 1000.;
+    double rate = elapsed > 0 ? (compressed - lastCompressedBytes) / elapsed : 0;
+    lastCompressedBytes = compressed;
+
+    QString text = tr("Compressed: %1 MB/s").arg(rate / 1e6, 0, 'f', 2);
+    if (uncompressed)
+    {
+        text += tr(", %1% of original").arg(100. * compressed / uncompressed, 0, 'f', 1);
+    }
+    ui->lCompression->setText(text);
+}
+
+DataRecorder::Format RecordPanel::currentFormat() const
+{
+    return static_cast<DataRecorder::Format>(ui->cbFormat->currentIndex());
+}
+
+void RecordPanel::updateFormatOptions()
+{
+    bool csv = currentFormat() == DataRecorder::Format::csv;
+    bool recording = recordAction.isChecked();
+
+    ui->leSeparator->setEnabled(csv && !recording);
+    ui->spDecimals->setEnabled(csv && !recording);
+    ui->cbHeader->setEnabled(csv);
+    ui->cbWindowsLE->setEnabled(csv && !recording);
+    ui->cbTimestamp->setEnabled(csv && !recording);
+    ui->cbTimestampFormat->setEnabled(csv);
+    // binary recordings are memory mapped when loaded, they can't be compressed
+    ui->cbCompression->setEnabled(csv && !recording);
+}
+
+bool RecordPanel::compressionSelected() const
+{
+    return ui->cbCompression->isChecked() && currentFormat() == DataRecorder::Format::csv;
+}
+
 void RecordPanel::saveSettings(QSettings* settings)
 {
     settings->beginGroup(SettingGroup_Record);
@@ -372,6 +529,13 @@ void RecordPanel::saveSettings(QSettings* settings)
     settings->setValue(SG_Record_Separator, ui->leSeparator->text());
     settings->setValue(SG_Record_Decimals, ui->spDecimals->text());
     settings->setValue(SG_Record_Timestamp, ui->cbTimestamp->isChecked());
+    settings->setValue(SG_Record_Decimation, ui->cbDecimation->currentIndex());
+    settings->setValue(SG_Record_DecimationFactor, ui->spDecimationFactor->value());
+    settings->setValue(SG_Record_Background, ui->cbBackground->isChecked());
+    settings->setValue(SG_Record_Format, ui->cbFormat->currentIndex());
+    settings->setValue(SG_Record_SyncInterval, ui->spSyncInterval->value());
+    settings->setValue(SG_Record_SyncSize, ui->spSyncSize->value());
+    settings->setValue(SG_Record_Compression, ui->cbCompression->isChecked());
 
     QString tsFormatStr;
     auto tsOpt = static_cast<DataRecorder::TimestampOption>(ui->cbTimestampFormat->currentData().toInt());
@@ -411,6 +575,20 @@ void RecordPanel::loadSettings(QSettings* settings)
     ui->spDecimals->setValue(settings->value(SG_Record_Decimals, ui->spDecimals->value()).toInt());
     ui->cbTimestamp->setChecked(
         settings->value(SG_Record_Timestamp, ui->cbTimestamp->isChecked()).toBool());
+    ui->cbDecimation->setCurrentIndex(
+        settings->value(SG_Record_Decimation, ui->cbDecimation->currentIndex()).toInt());
+    ui->spDecimationFactor->setValue(
+        settings->value(SG_Record_DecimationFactor, ui->spDecimationFactor->value()).toInt());
+    ui->cbBackground->setChecked(
+        settings->value(SG_Record_Background, ui->cbBackground->isChecked()).toBool());
+    ui->cbFormat->setCurrentIndex(
+        settings->value(SG_Record_Format, ui->cbFormat->currentIndex()).toInt());
+    ui->spSyncInterval->setValue(
+        settings->value(SG_Record_SyncInterval, ui->spSyncInterval->value()).toInt());
+    ui->spSyncSize->setValue(
+        settings->value(SG_Record_SyncSize, ui->spSyncSize->value()).toInt());
+    ui->cbCompression->setChecked(
+        settings->value(SG_Record_Compression, ui->cbCompression->isChecked()).toBool());
 
     // load timestamp format
     QString tsFormatStr = settings->value(SG_Record_TimestampFormat, "").toString();
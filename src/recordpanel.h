@@ -24,8 +24,11 @@
 #include <QString>
 #include <QToolBar>
 #include <QAction>
+#include <QTimer>
+#include <QElapsedTimer>
 
 #include "datarecorder.h"
+#include "asyncsink.h"
 #include "stream.h"
 
 namespace Ui {
@@ -64,6 +67,21 @@ private:
     QAction recordAction;
     bool overwriteSelected;
     DataRecorder recorder;
+    /// Number of packs that can wait for background writer
+    static const unsigned ASYNC_QUEUE_SIZE = 4096;
+    /// Period of backlog and compression display update (ms)
+    static const int STATS_UPDATE_PERIOD = 500;
+
+    /// Feeds `recorder` from a worker thread when background writing is enabled
+    AsyncSink asyncRecorder;
+    QTimer statsTimer;
+    /// Syncs the recording when data stops, used without background writer
+    QTimer idleSyncTimer;
+    /// Time since last compression display update
+    QElapsedTimer compressionTimer;
+    qint64 lastCompressedBytes;
+    /// Sink that is connected to the stream during recording
+    Sink* recordSink;
     Stream* _stream;
 
     /**
@@ -116,6 +134,11 @@ private:
     QString getSeparator() const;
 
     DataRecorder::TimestampOption currentTimestampOption() const;
+    DataRecorder::Format currentFormat() const;
+    /// Enables/disables CSV only options according to selected format
+    void updateFormatOptions();
+    /// Returns true if compression is selected and applies to selected format
+    bool compressionSelected() const;
 
 private slots:
     /**
@@ -129,6 +152,11 @@ private slots:
     bool selectFile();
 
     void onRecord(bool start);
+    void updateStats();
+    /// Displays background writer queue depth and dropped packs
+    void updateBacklog();
+    /// Displays compressed output rate and ratio
+    void updateCompression();
 
 };
 
@@ -0,0 +1,103 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "replotscheduler.h"
+
+ReplotScheduler::ReplotScheduler(QObject* parent) :
+    QObject(parent)
+{
+    _maxFps = 60;
+    numFrames = 0;
+    numRequests = 0;
+
+    frameTimer.setSingleShot(true);
+    frameTimer.setTimerType(Qt::PreciseTimer);
+    connect(&frameTimer, &QTimer::timeout, this, &ReplotScheduler::emitFrame);
+
+    statsTimer.setInterval(1000);
+    connect(&statsTimer, &QTimer::timeout, this, &ReplotScheduler::reportStats);
+    statsTimer.start();
+    sinceStats.start();
+}
+
+void ReplotScheduler::setMaxFps(unsigned fps)
+{
+    _maxFps = fps;
+
+    // re-arm pending frame with the new interval
+    if (frameTimer.isActive())
+    {
+        frameTimer.stop();
+        startFrame();
+    }
+}
+
+unsigned ReplotScheduler::maxFps() const
+{
+    return _maxFps;
+}
+
+int ReplotScheduler::interval() const
+{
+    return _maxFps ? 1000 / _maxFps : 0;
+}
+
+void ReplotScheduler::schedule()
+{
+    numRequests++;
+
+    // already waiting for a frame, this request is merged into it
+    if (frameTimer.isActive()) return;
+
+    startFrame();
+}
+
+void ReplotScheduler::startFrame()
+{
+    qint64 elapsed = sinceFrame.isValid() ? sinceFrame.elapsed() : interval();
+    if (elapsed >= interval())
+    {
+        emitFrame();
+    }
+    else
+    {
+        frameTimer.start(interval() - elapsed);
+    }
+}
+
+void ReplotScheduler::emitFrame()
+{
+    sinceFrame.start();
+    numFrames++;
+    emit frame();
+}
+
+void ReplotScheduler::reportStats()
+{
+    qint64 elapsed = sinceStats.restart();
+    if (elapsed <= 0) return;
+
+    // note: a pending frame may be counted in the next period
+    unsigned skipped = numRequests > numFrames ? numRequests - numFrames : 0;
+    emit statsChanged(1000 * float(numFrames) / elapsed, skipped);
+
+    numFrames = 0;
+    numRequests = 0;
+}
@@ -0,0 +1,82 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef REPLOTSCHEDULER_H
+#define REPLOTSCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+/**
+ * Coalesces replot requests and limits the rate of plot updates.
+ *
+ * Plot widgets call `schedule()` when they have new data instead of
+ * replotting immediately. `frame()` signal is emitted at most
+ * `maxFps()` times per second; widgets that have requested an update
+ * should replot when it's emitted. Requests made while a frame is
+ * pending are merged into that frame.
+ *
+ * Achieved frame rate and number of merged (skipped) requests are
+ * reported once per second with `statsChanged()`.
+ */
+class ReplotScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ReplotScheduler(QObject* parent = 0);
+
+    /// Sets the frame rate limit, 0 means unlimited
+    void setMaxFps(unsigned fps);
+    unsigned maxFps() const;
+
+public slots:
+    /// Requests a frame. Returns immediately, `frame()` is emitted later
+    /// unless enough time has passed since the last frame.
+    void schedule();
+
+signals:
+    /// Plots with pending updates should replot now
+    void frame();
+    /// Emitted per second with number of frames and number of requests
+    /// that didn't result in a frame on their own.
+    void statsChanged(float fps, unsigned skipped);
+
+private:
+    unsigned _maxFps;
+    QTimer frameTimer;          ///< single shot, fires pending frame
+    QElapsedTimer sinceFrame;   ///< time since last frame
+    QTimer statsTimer;
+    QElapsedTimer sinceStats;
+    unsigned numFrames;
+    unsigned numRequests;
+
+    /// Frame interval in milliseconds
+    int interval() const;
+    /// Emits a frame now or starts the timer for the remaining interval
+    void startFrame();
+
+private slots:
+    void emitFrame();
+    void reportStats();
+};
+
+#endif // REPLOTSCHEDULER_H
@@ -17,6 +17,7 @@
   along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <QtGlobal>
 
 #include "ringbuffer.h"
@@ -24,8 +25,9 @@
 RingBuffer::RingBuffer(unsigned n)
 {
     _size = n;
-    data = new double[_size]();
+    data = new double[_size];
     headIndex = 0;
+    _numValid = 0;
 
     limInvalid = false;
     limCache = {0, 0};
@@ -43,6 +45,9 @@ unsigned RingBuffer::size() const
 
 double RingBuffer::sample(unsigned i) const
 {
+    // invalid samples are read as 0
+    if (i < _size - _numValid) return 0.;
+
     unsigned index = headIndex + i;
     if (index >= _size) index -= _size;
     return data[index];
@@ -54,6 +59,54 @@ Range RingBuffer::limits() const
     return limCache;
 }
 
+Range RingBuffer::rangeLimits(unsigned start, unsigned end) const
+{
+    Q_ASSERT(start < end && end <= _size);
+
+    Range r;
+    bool first = true;
+    auto scan = [this, &r, &first](unsigned from, unsigned to)
+        {
+            if (from >= to) return;
+            if (first)
+            {
+                r = {data[from], data[from]};
+                first = false;
+            }
+            for (unsigned i = from; i < to; i++)
+            {
+                if (data[i] < r.start) r.start = data[i];
+                else if (data[i] > r.end) r.end = data[i];
+            }
+        };
+
+    // invalid samples are read as 0
+    unsigned firstValid = _size - _numValid;
+    if (start < firstValid)
+    {
+        r = {0, 0};
+        first = false;
+        start = firstValid;
+        if (start >= end) return r;
+    }
+
+    // convert to array indexes, range may wrap around the end of the array
+    unsigned from = headIndex + start;
+    if (from >= _size) from -= _size;
+    unsigned n = end - start;
+    unsigned firstEnd = from + n > _size ? _size : from + n;
+
+    scan(from, firstEnd);
+    scan(0, n - (firstEnd - from));
+
+    return r;
+}
+
+unsigned RingBuffer::numValid() const
+{
+    return _numValid;
+}
+
 void RingBuffer::resize(unsigned n)
 {
     Q_ASSERT(n != _size);
@@ -63,28 +116,20 @@ void RingBuffer::resize(unsigned n)
 
     double* newData = new double[n];
 
-    // move data to new array
-    int fill_start = offset > 0 ? offset : 0;
-
-    for (int i = fill_start; i < int(n); i++)
+    // move only valid data to new array, rest of the array is left
+    // uninitialized as it's not valid
+    unsigned newNumValid = std::min(_numValid, n);
+    for (unsigned i = n - newNumValid; i < n; i++)
     {
         newData[i] = sample(i - offset);
     }
 
-    // fill the beginning of the new data
-    if (fill_start > 0)
-    {
-        for (int i = 0; i < fill_start; i++)
-        {
-            newData[i] = 0;
-        }
-    }
-
     // data is ready, clean up and re-point
-    delete data;
+    delete[] data;
     data = newData;
     headIndex = 0;
     _size = n;
+    _numValid = newNumValid;
 
     // invalidate bounding rectangle
     limInvalid = true;
@@ -136,16 +181,15 @@ void RingBuffer::addSamples(double* samples, unsigned n)
         headIndex = 0;
     }
 
+    _numValid = std::min(_numValid + n, _size);
+
     // invalidate cache
     limInvalid = true;
 }
 
 void RingBuffer::clear()
 {
-    for (unsigned i=0; i < _size; i++)
-    {
-        data[i] = 0.;
-    }
+    _numValid = 0;
 
     limCache = {0, 0};
     limInvalid = false;
@@ -153,20 +197,38 @@ void RingBuffer::clear()
 
 void RingBuffer::updateLimits() const
 {
-    limCache.start = data[0];
-    limCache.end = data[0];
+    limInvalid = false;
 
-    for (unsigned i = 0; i < _size; i++)
+    if (!_numValid)
     {
-        if (data[i] > limCache.end)
-        {
-            limCache.end = data[i];
-        }
-        else if (data[i] < limCache.start)
-        {
-            limCache.start = data[i];
-        }
+        limCache = {0, 0};
+        return;
     }
 
-    limInvalid = false;
+    // valid samples are at the end of the buffer, right before
+    // `headIndex`, they may wrap around the end of the array
+    unsigned start = headIndex >= _numValid ?
+        headIndex - _numValid : _size - (_numValid - headIndex);
+    unsigned firstEnd = start + _numValid > _size ? _size : start + _numValid;
+
+    limCache.start = data[start];
+    limCache.end = data[start];
+
+    auto scan = [this](unsigned from, unsigned to)
+        {
+            for (unsigned i = from; i < to; i++)
+            {
+                if (data[i] > limCache.end)
+                {
+                    limCache.end = data[i];
+                }
+                else if (data[i] < limCache.start)
+                {
+                    limCache.start = data[i];
+                }
+            }
+        };
+
+    scan(start, firstEnd);
+    scan(0, _numValid - (firstEnd - start)); // wrapped part, if any
 }
@@ -22,7 +22,13 @@
 
 #include "framebuffer.h"
 
-/// A fast buffer implementation for storing data.
+/**
+ * A fast buffer implementation for storing data.
+ *
+ * Buffer keeps track of the number of valid samples it holds. Invalid
+ * samples (ie. not yet received or cleared) are read as `0` but they
+ * are not included in `limits()` calculation.
+ */
 class RingBuffer : public WFrameBuffer
 {
 public:
@@ -32,6 +38,8 @@ public:
     virtual unsigned size() const;
     virtual double sample(unsigned i) const;
     virtual Range limits() const;
+    virtual Range rangeLimits(unsigned start, unsigned end) const;
+    virtual unsigned numValid() const;
     virtual void resize(unsigned n);
     virtual void addSamples(double* samples, unsigned n);
     virtual void clear();
@@ -40,6 +48,7 @@ private:
     unsigned _size;            ///< size of `data`
     double* data;              ///< storage
     unsigned headIndex;        ///< indicates the actual `0` index of the ring buffer
+    unsigned _numValid;        ///< number of valid samples at the end of the buffer
 
     mutable bool limInvalid;   ///< Indicates that limits needs to be re-calculated
     mutable Range limCache;    ///< Cache for limits()
@@ -0,0 +1,110 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+
+#include "rowring.h"
+
+RowRing::RowRing(unsigned maxRows)
+{
+    _maxRows = std::max(1u, maxRows);
+    _numChannels = 0;
+    head = 0;
+    count = 0;
+}
+
+unsigned RowRing::maxRows() const
+{
+    return _maxRows;
+}
+
+unsigned RowRing::numRows() const
+{
+    return count;
+}
+
+unsigned RowRing::numChannels() const
+{
+    return _numChannels;
+}
+
+void RowRing::setMaxRows(unsigned n)
+{
+    n = std::max(1u, n);
+    if (n == _maxRows) return;
+
+    // keep the newest rows, in order
+    unsigned keep = std::min(count, n);
+    std::vector<double> newRing(size_t(n) * _numChannels);
+    for (unsigned i = 0; i < keep; i++)
+    {
+        std::copy_n(row(count - keep + i), _numChannels,
+                    newRing.begin() + size_t(i) * _numChannels);
+    }
+
+    ring.swap(newRing);
+    _maxRows = n;
+    head = 0;
+    count = keep;
+}
+
+unsigned RowRing::append(const SamplePack& data)
+{
+    unsigned nc = data.numChannels();
+    if (nc != _numChannels)
+    {
+        _numChannels = nc;
+        ring.assign(size_t(_maxRows) * nc, 0);
+        head = 0;
+        count = 0;
+    }
+
+    // only last `_maxRows` samples can be stored
+    unsigned ns = data.numSamples();
+    unsigned start = ns > _maxRows ? ns - _maxRows : 0;
+    unsigned dropped = count + ns > _maxRows ? count + ns - _maxRows : 0;
+
+    for (unsigned ci = 0; ci < nc; ci++)
+    {
+        const double* src = data.data(ci);
+        unsigned pos = (head + count + start) % _maxRows;
+        for (unsigned i = start; i < ns; i++)
+        {
+            ring[size_t(pos) * nc + ci] = src[i];
+            if (++pos == _maxRows) pos = 0;
+        }
+    }
+
+    count = std::min(count + ns, _maxRows);
+    head = (head + dropped) % _maxRows;
+
+    return dropped;
+}
+
+const double* RowRing::row(unsigned i) const
+{
+    return &ring[size_t((head + i) % _maxRows) * _numChannels];
+}
+
+void RowRing::clear()
+{
+    head = 0;
+    count = 0;
+}
@@ -0,0 +1,65 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef ROWRING_H
+#define ROWRING_H
+
+#include <vector>
+
+#include "samplepack.h"
+
+/**
+ * Keeps last `maxRows()` samples of all channels as rows in a ring
+ * buffer. Rows are stored row major and indexed from the oldest row.
+ * Used by `TextRowView`.
+ */
+class RowRing
+{
+public:
+    explicit RowRing(unsigned maxRows = 1000);
+
+    /// Maximum number of rows kept
+    unsigned maxRows() const;
+    /// Number of rows currently stored
+    unsigned numRows() const;
+    unsigned numChannels() const;
+    /// Sets maximum number of rows, keeps the newest rows
+    void setMaxRows(unsigned n);
+    /**
+     * Appends samples as new rows. Clears the buffer if number of
+     * channels changes.
+     *
+     * @return number of rows dropped to make space, including new
+     * rows that didn't fit
+     */
+    unsigned append(const SamplePack& data);
+    /// Returns pointer to the samples of `i`th oldest row
+    const double* row(unsigned i) const;
+    void clear();
+
+private:
+    unsigned _maxRows;
+    unsigned _numChannels;
+    std::vector<double> ring; ///< rows, row major
+    unsigned head;            ///< index of the oldest row in `ring`
+    unsigned count;           ///< number of stored rows
+};
+
+#endif // ROWRING_H
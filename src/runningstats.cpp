@@ -0,0 +1,198 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "runningstats.h"
+
+RunningStats::RunningStats()
+{
+    clear();
+}
+
+void RunningStats::clear()
+{
+    _count = 0;
+    _mean = 0;
+    m2 = 0;
+    _min = std::numeric_limits<double>::infinity();
+    _max = -std::numeric_limits<double>::infinity();
+}
+
+void RunningStats::addSamples(const double* samples, unsigned n)
+{
+    if (n == 0) return;
+
+    // reduce the block in two passes, these loops vectorize well
+    double sum = 0;
+    double bmin = samples[0];
+    double bmax = samples[0];
+    for (unsigned i = 0; i < n; i++)
+    {
+        sum += samples[i];
+        bmin = std::min(bmin, samples[i]);
+        bmax = std::max(bmax, samples[i]);
+    }
+    double bmean = sum / n;
+
+    double bm2 = 0;
+    for (unsigned i = 0; i < n; i++)
+    {
+        double d = samples[i] - bmean;
+        bm2 += d * d;
+    }
+
+    RunningStats block;
+    block._count = n;
+    block._mean = bmean;
+    block.m2 = bm2;
+    block._min = bmin;
+    block._max = bmax;
+    merge(block);
+}
+
+void RunningStats::merge(const RunningStats& other)
+{
+    if (other._count == 0) return;
+    if (_count == 0)
+    {
+        *this = other;
+        return;
+    }
+
+    double na = _count;
+    double nb = other._count;
+    double n = na + nb;
+    double delta = other._mean - _mean;
+
+    _mean += delta * nb / n;
+    m2 += other.m2 + delta * delta * na * nb / n;
+    _count += other._count;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+}
+
+quint64 RunningStats::count() const
+{
+    return _count;
+}
+
+double RunningStats::mean() const
+{
+    return _count ? _mean : NAN;
+}
+
+double RunningStats::rms() const
+{
+    if (!_count) return NAN;
+    // mean of squares = variance + mean^2
+    return std::sqrt(m2 / _count + _mean * _mean);
+}
+
+double RunningStats::min() const
+{
+    return _count ? _min : NAN;
+}
+
+double RunningStats::max() const
+{
+    return _count ? _max : NAN;
+}
+
+double RunningStats::stdDev() const
+{
+    return _count ? std::sqrt(m2 / _count) : NAN;
+}
+
+double RunningStats::peakToPeak() const
+{
+    return _count ? _max - _min : NAN;
+}
+
+WindowStats::WindowStats(unsigned windowSize)
+{
+    setWindowSize(windowSize);
+}
+
+void WindowStats::setWindowSize(unsigned size)
+{
+    Q_ASSERT(size > 0);
+
+    _windowSize = size;
+    blockSize = std::max(1u, (size + NUM_BLOCKS - 1) / NUM_BLOCKS);
+    blocks.assign(std::min(size, (unsigned) NUM_BLOCKS), RunningStats());
+    clear();
+}
+
+unsigned WindowStats::windowSize() const
+{
+    return _windowSize;
+}
+
+void WindowStats::clear()
+{
+    for (auto& b : blocks) b.clear();
+    head = 0;
+    numFull = 0;
+    current.clear();
+}
+
+void WindowStats::addSamples(const double* samples, unsigned n)
+{
+    unsigned numBlocks = blocks.size();
+    while (n > 0)
+    {
+        unsigned space = blockSize - current.count();
+        unsigned take = std::min(space, n);
+        current.addSamples(samples, take);
+        samples += take;
+        n -= take;
+
+        if (current.count() == blockSize)
+        {
+            // push current block to ring, replacing the oldest if full
+            if (numFull < numBlocks)
+            {
+                blocks[(head + numFull) % numBlocks] = current;
+                numFull++;
+            }
+            else
+            {
+                blocks[head] = current;
+                head = (head + 1) % numBlocks;
+            }
+            current.clear();
+        }
+    }
+}
+
+RunningStats WindowStats::stats() const
+{
+    RunningStats r;
+    unsigned numBlocks = blocks.size();
+    for (unsigned i = 0; i < numFull; i++)
+    {
+        r.merge(blocks[(head + i) % numBlocks]);
+    }
+    r.merge(current);
+    return r;
+}
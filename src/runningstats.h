@@ -0,0 +1,96 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef RUNNINGSTATS_H
+#define RUNNINGSTATS_H
+
+#include <vector>
+#include <QtGlobal>
+
+/**
+ * Incrementally calculated statistics of a signal.
+ *
+ * Mean and variance are kept with Welford's method. Blocks of samples
+ * are first reduced on their own and then merged (Chan et al.) which
+ * is both stable and cheap.
+ */
+class RunningStats
+{
+public:
+    RunningStats();
+
+    /// Adds a block of samples
+    void addSamples(const double* samples, unsigned n);
+    /// Merges another set of statistics into this one
+    void merge(const RunningStats& other);
+    void clear();
+
+    quint64 count() const;
+    double mean() const;
+    double rms() const;
+    double min() const;
+    double max() const;
+    /// Population standard deviation
+    double stdDev() const;
+    double peakToPeak() const;
+
+private:
+    quint64 _count;
+    double _mean;
+    double m2;                  ///< sum of squared differences from the mean
+    double _min;
+    double _max;
+};
+
+/**
+ * Statistics of the last `windowSize` samples.
+ *
+ * Window is divided into fixed number of blocks, each with its own
+ * `RunningStats`. When a block is filled oldest block is dropped, so
+ * adding samples never requires visiting old samples. In exchange
+ * window length is not exact; result covers the last `windowSize` to
+ * `windowSize + windowSize/NUM_BLOCKS` samples.
+ */
+class WindowStats
+{
+public:
+    /// Number of blocks that make up the window
+    static const unsigned NUM_BLOCKS = 64;
+
+    explicit WindowStats(unsigned windowSize = 1);
+
+    void setWindowSize(unsigned size);
+    unsigned windowSize() const;
+
+    void addSamples(const double* samples, unsigned n);
+    void clear();
+    /// Returns combined statistics of the window
+    RunningStats stats() const;
+
+private:
+    unsigned _windowSize;
+    unsigned blockSize;
+    std::vector<RunningStats> blocks; ///< ring of full blocks
+    unsigned head;                    ///< index of the oldest block
+    unsigned numFull;                 ///< number of full blocks
+    RunningStats current;             ///< block being filled
+};
+
+#endif // RUNNINGSTATS_H
@@ -28,6 +28,8 @@ SamplePack::SamplePack(unsigned ns, unsigned nc, bool x)
 
     _numSamples = ns;
     _numChannels = nc;
+    _stride = ns;
+    owner = true;
 
     _yData = new double[_numSamples * _numChannels]();
     if (x)
@@ -40,17 +42,42 @@ SamplePack::SamplePack(unsigned ns, unsigned nc, bool x)
     }
 }
 
+SamplePack::SamplePack(unsigned ns, unsigned nc, double* yData, unsigned stride,
+                       double* xData)
+{
+    Q_ASSERT(ns > 0 && nc > 0 && stride >= ns);
+
+    _numSamples = ns;
+    _numChannels = nc;
+    _stride = stride;
+    owner = false;
+    _yData = yData;
+    _xData = xData;
+}
+
 SamplePack::SamplePack(const SamplePack& other) :
     SamplePack(other.numSamples(), other.numChannels(), other.hasX())
 {
     size_t dataSize = sizeof(double) * numSamples();
     if (hasX())
         memcpy(xData(), other.xData(), dataSize);
-    memcpy(_yData, other._yData, dataSize * numChannels());
+    if (other._stride == _stride)
+    {
+        memcpy(_yData, other._yData, dataSize * numChannels());
+    }
+    else
+    {
+        for (unsigned ci = 0; ci < numChannels(); ci++)
+        {
+            memcpy(data(ci), other.data(ci), dataSize);
+        }
+    }
 }
 
 SamplePack::~SamplePack()
 {
+    if (!owner) return;
+
     delete[] _yData;
     if (_xData != nullptr)
     {
@@ -84,7 +111,7 @@ double* SamplePack::data(unsigned channel) const
 {
     Q_ASSERT(channel < _numChannels);
 
-    return &_yData[channel * _numSamples];
+    return &_yData[size_t(channel) * _stride];
 }
 
 double* SamplePack::xData()
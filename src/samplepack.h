@@ -29,6 +29,19 @@ public:
      * @param x has X channel
      */
     SamplePack(unsigned ns, unsigned nc, bool x = false);
+    /**
+     * Creates a view of existing data, data isn't copied or owned and
+     * must outlive the pack.
+     *
+     * @param ns number of samples
+     * @param nc number of channels
+     * @param yData data of channel `i` starts at `yData + i * stride`
+     * @param stride distance between channels, must be >= `ns`
+     * @param xData X channel data, `nullptr` if there is no X channel
+     */
+    SamplePack(unsigned ns, unsigned nc, double* yData, unsigned stride,
+               double* xData = nullptr);
+    /// Copy always owns its data
     SamplePack(const SamplePack& other);
     ~SamplePack();
 
@@ -43,6 +56,8 @@ public:
 
 private:
     unsigned _numSamples, _numChannels;
+    unsigned _stride;           ///< distance between channels in `_yData`
+    bool owner;                 ///< data is allocated by this pack
     double* _xData;
     double* _yData;
 };
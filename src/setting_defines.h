@@ -31,6 +31,9 @@ const char SettingGroup_Plot[] = "Plot";
 const char SettingGroup_Commands[] = "Commands";
 const char SettingGroup_Record[] = "Record";
 const char SettingGroup_TextView[] = "TextView";
+const char SettingGroup_Math[] = "Math";
+const char SettingGroup_Filter[] = "Filter";
+const char SettingGroup_Trigger[] = "Trigger";
 const char SettingGroup_UpdateCheck[] = "UpdateCheck";
 
 // mainwindow setting keys
@@ -100,8 +103,13 @@ const char SG_Plot_MinorGrid[] = "minorGrid";
 const char SG_Plot_Legend[] = "legend";
 const char SG_Plot_LegendPos[] = "legendPos";
 const char SG_Plot_MultiPlot[] = "multiPlot";
+const char SG_Plot_Lanes[] = "lanes";
 const char SG_Plot_Symbols[] = "symbols";
 const char SG_Plot_LineThickness[] = "lineThickness";
+const char SG_Plot_CompressBuffer[] = "compressBuffer";
+const char SG_Plot_Stats[] = "statistics";
+const char SG_Plot_MaxFps[] = "maxFps";
+const char SG_Plot_Incremental[] = "incremental";
 
 // command setting keys
 const char SG_Commands_Command[] = "command";
@@ -119,11 +127,37 @@ const char SG_Record_DisableBuffering[] = "disableBuffering";
 const char SG_Record_Timestamp[]        = "timestamp";
 const char SG_Record_TimestampFormat[]  = "timestampFormat";
 const char SG_Record_Decimals[]         = "decimals";
+const char SG_Record_Decimation[]       = "decimation";
+const char SG_Record_DecimationFactor[] = "decimationFactor";
+const char SG_Record_Background[]       = "background";
+const char SG_Record_Format[]           = "format";
+const char SG_Record_SyncInterval[]     = "syncInterval";
+const char SG_Record_SyncSize[]         = "syncSize";
+const char SG_Record_Compression[]      = "compression";
 
 // text view settings keys
 const char SG_TextView_NumLines[] = "numLines";
 const char SG_TextView_Decimals[] = "decimals";
 
+// math panel settings keys
+const char SG_Math_Expressions[] = "expressions";
+
+// filter panel settings keys
+const char SG_Filter_Filters[] = "filters";
+const char SG_Filter_Decimation[] = "decimation";
+
+// trigger panel settings keys
+const char SG_Trigger_Enabled[] = "enabled";
+const char SG_Trigger_Sweep[] = "sweep";
+const char SG_Trigger_Channel[] = "channel";
+const char SG_Trigger_Mode[] = "mode";
+const char SG_Trigger_PreTrigger[] = "preTrigger";
+const char SG_Trigger_Level[] = "level";
+const char SG_Trigger_Level2[] = "level2";
+const char SG_Trigger_Hysteresis[] = "hysteresis";
+const char SG_Trigger_MinWidth[] = "minWidth";
+const char SG_Trigger_MaxWidth[] = "maxWidth";
+
 // update check settings keys
 const char SG_UpdateCheck_Periodic[]  = "periodicCheck";
 const char SG_UpdateCheck_LastCheck[] = "lastCheck";
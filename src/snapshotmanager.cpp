@@ -27,9 +27,14 @@
 #include <QPointF>
 #include <QIcon>
 #include <QtDebug>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "mainwindow.h"
 #include "snapshotmanager.h"
+#include "binaryrecording.h"
+#include "compressedfile.h"
 
 SnapshotManager::SnapshotManager(MainWindow* mainWindow,
                                  Stream* stream) :
@@ -44,7 +49,7 @@ SnapshotManager::SnapshotManager(MainWindow* mainWindow,
     _takeSnapshotAction.setToolTip("Take a snapshot of current plot");
     _takeSnapshotAction.setShortcut(QKeySequence("Ctrl+P"));
     _takeSnapshotAction.setIcon(QIcon::fromTheme("camera"));
-    loadSnapshotAction.setToolTip("Load snapshots from CSV files");
+    loadSnapshotAction.setToolTip("Load snapshots from CSV files or binary recordings");
     clearAction.setToolTip("Delete all snapshots");
     connect(&_takeSnapshotAction, SIGNAL(triggered(bool)),
             this, SLOT(takeSnapshot()));
@@ -69,10 +74,22 @@ Snapshot* SnapshotManager::makeSnapshot() const
     QString name = QTime::currentTime().toString("'Snapshot ['HH:mm:ss']'");
     auto snapshot = new Snapshot(_mainWindow, name, *(_stream->infoModel()));
 
+    // only copy the valid (received) portion of the buffers, channels
+    // may differ if they are added later so take the longest one
+    unsigned numSamples = _stream->numSamples();
+    unsigned numValid = 0;
     for (unsigned ci = 0; ci < _stream->numChannels(); ci++)
     {
-        snapshot->xData.append(new IndexBuffer(_stream->numSamples()));
-        snapshot->yData.append(new ReadOnlyBuffer(_stream->channel(ci)->yData()));
+        numValid = std::max(numValid, _stream->channel(ci)->yData()->numValid());
+    }
+    // nothing received yet, fallback to a full (empty) copy
+    if (numValid == 0) numValid = numSamples;
+
+    for (unsigned ci = 0; ci < _stream->numChannels(); ci++)
+    {
+        auto yData = _stream->channel(ci)->yData();
+        snapshot->xData.append(new IndexBuffer(numValid));
+        snapshot->yData.append(new ReadOnlyBuffer(yData, numSamples - numValid, numValid));
     }
 
     return snapshot;
@@ -127,7 +144,8 @@ void SnapshotManager::deleteSnapshot(Snapshot* snapshot)
 
 void SnapshotManager::loadSnapshots()
 {
-    auto files = QFileDialog::getOpenFileNames(_mainWindow, tr("Load CSV File"));
+    auto files = QFileDialog::getOpenFileNames(
+        _mainWindow, tr("Load CSV or Binary Recording File"));
 
     for (auto f : files)
     {
@@ -147,14 +165,41 @@ void SnapshotManager::loadSnapshotFromFile(QString fileName)
         return;
     }
 
+    // compressed recordings are read through a decompressing device
+    CompressedFile compressedFile;
+    QIODevice* device = &file;
+    if (CompressedFile::isCompressedFile(&file))
+    {
+        file.close();
+        compressedFile.setFileName(fileName);
+        if (!compressedFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            qCritical() << "Couldn't open file: " << fileName;
+            qCritical() << compressedFile.errorString();
+            return;
+        }
+        device = &compressedFile;
+    }
+
+    if (BinaryRecording::isBinaryRecording(device))
+    {
+        if (device == &compressedFile)
+        {
+            qCritical() << "Compressed binary recordings can't be loaded as snapshot:" << fileName;
+            return;
+        }
+        loadBinaryRecording(fileName);
+        return;
+    }
+
     // read first row as headlines and determine number of channels
-    auto headLine = QString(file.readLine());
+    auto headLine = QString(device->readLine());
     QStringList channelNames = headLine.split(',');
     unsigned numOfChannels = channelNames.size();
 
     // read data
     QVector<QVector<double>> data(numOfChannels);
-    QTextStream ts(&file);
+    QTextStream ts(device);
     QString line;
     unsigned lineNum = 1;
 
@@ -210,6 +255,39 @@ void SnapshotManager::loadSnapshotFromFile(QString fileName)
     addSnapshot(snapshot, false);
 }
 
+void SnapshotManager::loadBinaryRecording(QString fileName)
+{
+    BinaryRecordingReader reader;
+    if (!reader.open(fileName))
+    {
+        qCritical() << "Couldn't load recording:" << fileName;
+        qCritical() << reader.errorString();
+        return;
+    }
+
+    auto numSamples = reader.numSamples();
+    if (numSamples > std::numeric_limits<unsigned>::max())
+    {
+        qCritical() << "Recording is too large to load as snapshot:" << fileName;
+        return;
+    }
+
+    auto snapshot = new Snapshot(
+        _mainWindow, QFileInfo(fileName).baseName(),
+        ChannelInfoModel(reader.channelNames()), true);
+
+    // samples are converted directly from the mapped file
+    std::vector<double> data(numSamples);
+    for (unsigned ci = 0; ci < reader.numChannels(); ci++)
+    {
+        reader.readChannel(ci, 0, numSamples, data.data());
+        snapshot->xData.append(new IndexBuffer(numSamples));
+        snapshot->yData.append(new ReadOnlyBuffer(data.data(), numSamples));
+    }
+
+    addSnapshot(snapshot, false);
+}
+
 QMenu* SnapshotManager::menu()
 {
     return &_menu;
@@ -59,6 +59,8 @@ private:
 
     void addSnapshot(Snapshot* snapshot, bool update_menu=true);
     void updateMenu();
+    /// Loads a recording in binary format as snapshot
+    void loadBinaryRecording(QString fileName);
 
 private slots:
     void takeSnapshot();
@@ -0,0 +1,299 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <QMutexLocker>
+
+#include "spectrumanalyzer.h"
+#include "fft.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/// Maximum number of pending blocks, older blocks are skipped
+static const unsigned MAX_BACKLOG = 4;
+/// Maximum number of columns waiting to be taken for waterfall
+static const unsigned MAX_COLUMNS = 1024;
+
+/// Lives in the worker thread, methods are invoked from analyzer via event queue
+class SpectrumWorker : public QObject
+{
+public:
+    SpectrumWorker(SpectrumAnalyzer::Result* result)
+    {
+        _result = result;
+        fft = nullptr;
+    }
+
+    ~SpectrumWorker()
+    {
+        delete fft;
+    }
+
+    void configure(const SpectrumAnalyzer::Config& config)
+    {
+        _config = config;
+        unsigned n = config.fftSize;
+
+        delete fft;
+        fft = new RealFFT(n);
+
+        window.resize(n);
+        double sum = 0;
+        for (unsigned i = 0; i < n; i++)
+        {
+            double x = 2 * M_PI * i / n;
+            switch (config.window)
+            {
+                case SpectrumAnalyzer::Hann:
+                    window[i] = 0.5 - 0.5 * cos(x);
+                    break;
+                case SpectrumAnalyzer::Blackman:
+                    window[i] = 0.42 - 0.5 * cos(x) + 0.08 * cos(2 * x);
+                    break;
+                default:
+                    window[i] = 1;
+            }
+            sum += window[i];
+        }
+        // so that a sine of amplitude A shows as A^2 (single sided)
+        scale = 4 / (sum * sum);
+
+        hop = config.hop();
+        pending.clear();
+        head = 0;
+        block.resize(n);
+        power.resize(n / 2 + 1);
+        accum.assign(n / 2 + 1, 0.);
+        numAccum = 0;
+        columns.clear();
+    }
+
+    void addSamples(const QVector<double>& samples)
+    {
+        if (fft == nullptr) return;
+
+        pending.insert(pending.end(), samples.begin(), samples.end());
+
+        const unsigned n = _config.fftSize;
+        size_t available = pending.size() - head;
+        if (available < n) return;
+
+        // skip old blocks if we are falling behind
+        size_t numBlocks = (available - n) / hop + 1;
+        if (numBlocks > MAX_BACKLOG)
+        {
+            head += (numBlocks - MAX_BACKLOG) * hop;
+        }
+
+        while (pending.size() - head >= n)
+        {
+            processBlock(&pending[head]);
+            head += hop;
+        }
+        publish();
+
+        // drop consumed samples, not every time to avoid moving data too often
+        if (head > pending.size() / 2)
+        {
+            pending.erase(pending.begin(), pending.begin() + head);
+            head = 0;
+        }
+    }
+
+private:
+    SpectrumAnalyzer::Config _config;
+    SpectrumAnalyzer::Result* _result;
+    RealFFT* fft;
+    std::vector<double> window;
+    double scale;
+    unsigned hop;
+    std::vector<double> pending; ///< samples waiting to be processed
+    size_t head;                 ///< start of next block in `pending`
+    std::vector<double> block, power, accum;
+    unsigned numAccum;
+    std::vector<float> columns;  ///< for waterfall, not yet published
+
+    void processBlock(const double* data)
+    {
+        const unsigned n = _config.fftSize;
+        for (unsigned i = 0; i < n; i++)
+        {
+            block[i] = data[i] * window[i];
+        }
+        fft->powerSpectrum(block.data(), power.data());
+
+        const unsigned nb = power.size();
+        switch (_config.mode)
+        {
+            case SpectrumAnalyzer::Average:
+            {
+                numAccum = std::min(numAccum + 1, std::max(_config.averages, 1u));
+                double k = 1. / numAccum;
+                for (unsigned i = 0; i < nb; i++)
+                {
+                    accum[i] += (power[i] * scale - accum[i]) * k;
+                }
+                break;
+            }
+            case SpectrumAnalyzer::PeakHold:
+                for (unsigned i = 0; i < nb; i++)
+                {
+                    accum[i] = std::max(accum[i], power[i] * scale);
+                }
+                break;
+            default:
+                for (unsigned i = 0; i < nb; i++)
+                {
+                    accum[i] = power[i] * scale;
+                }
+        }
+
+        if (_config.waterfall)
+        {
+            for (unsigned i = 0; i < nb; i++)
+            {
+                columns.push_back(10 * log10(std::max(accum[i], 1e-30)));
+            }
+        }
+    }
+
+    void publish()
+    {
+        QMutexLocker locker(&_result->mutex);
+        auto& out = _result->data;
+        out.resize(accum.size());
+        for (unsigned i = 0; i < accum.size(); i++)
+        {
+            out[i] = 10 * log10(std::max(accum[i], 1e-30));
+        }
+        _result->fresh = true;
+
+        if (!_config.waterfall) return;
+
+        // drop oldest columns if they are not taken in time
+        const size_t nb = accum.size();
+        auto& cols = _result->columns;
+        if (_result->columnSize != nb) cols.clear();
+        cols.insert(cols.end(), columns.begin(), columns.end());
+        if (cols.size() > MAX_COLUMNS * nb)
+        {
+            cols.erase(cols.begin(), cols.end() - MAX_COLUMNS * nb);
+        }
+        _result->columnSize = nb;
+        columns.clear();
+    }
+};
+
+unsigned SpectrumAnalyzer::Config::hop() const
+{
+    return std::max(1u, (unsigned) std::lround(fftSize * (1 - overlap)));
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer(QObject* parent) :
+    QObject(parent)
+{
+    _numChannels = 0;
+
+    worker = new SpectrumWorker(&result);
+    worker->moveToThread(&thread);
+    connect(&thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread.start();
+
+    setConfig(_config);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    thread.quit();
+    thread.wait();
+}
+
+void SpectrumAnalyzer::setConfig(const Config& config)
+{
+    Q_ASSERT(config.overlap >= 0 && config.overlap < 1);
+
+    _config = config;
+    {
+        QMutexLocker locker(&result.mutex);
+        result.fresh = false;
+        result.columns.clear();
+    }
+
+    auto w = worker;
+    QMetaObject::invokeMethod(worker, [w, config]() {w->configure(config);});
+}
+
+SpectrumAnalyzer::Config SpectrumAnalyzer::config() const
+{
+    return _config;
+}
+
+unsigned SpectrumAnalyzer::numChannels() const
+{
+    return _numChannels;
+}
+
+bool SpectrumAnalyzer::takeSpectrum(QVector<double>& out)
+{
+    QMutexLocker locker(&result.mutex);
+    if (!result.fresh) return false;
+
+    out = result.data;
+    result.fresh = false;
+    return true;
+}
+
+unsigned SpectrumAnalyzer::takeColumns(std::vector<float>& out, unsigned numBins)
+{
+    QMutexLocker locker(&result.mutex);
+    out.clear();
+    if (result.columnSize == numBins)
+    {
+        out.swap(result.columns);
+    }
+    result.columns.clear();
+
+    return numBins ? out.size() / numBins : 0;
+}
+
+void SpectrumAnalyzer::setNumChannels(unsigned nc, bool x)
+{
+    _numChannels = nc;
+    Sink::setNumChannels(nc, x);
+    emit numChannelsChanged(nc);
+}
+
+void SpectrumAnalyzer::feedIn(const SamplePack& data)
+{
+    if (_config.channel < data.numChannels())
+    {
+        unsigned ns = data.numSamples();
+        const double* src = data.data(_config.channel);
+        QVector<double> samples(src, src + ns);
+
+        auto w = worker;
+        QMetaObject::invokeMethod(worker, [w, samples]() {w->addSamples(samples);});
+    }
+
+    Sink::feedIn(data);
+}
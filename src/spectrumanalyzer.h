@@ -0,0 +1,130 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SPECTRUMANALYZER_H
+#define SPECTRUMANALYZER_H
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QVector>
+#include <vector>
+
+#include "sink.h"
+
+class SpectrumWorker;
+
+/**
+ * Calculates the power spectrum of a channel. Meant to be connected
+ * to `Stream` as a follower.
+ *
+ * Samples of the selected channel are passed to a worker thread, which
+ * processes windowed, overlapping blocks. Latest result is kept until
+ * it's taken with `takeSpectrum()`, so the consumer decides how often
+ * to update. If the worker falls behind, older blocks are skipped.
+ */
+class SpectrumAnalyzer : public QObject, public Sink
+{
+    Q_OBJECT
+
+public:
+    enum Window
+    {
+        Rectangular = 0,
+        Hann,
+        Blackman
+    };
+
+    enum Mode
+    {
+        Normal = 0,
+        Average,                ///< exponential averaging of power
+        PeakHold
+    };
+
+    struct Config
+    {
+        unsigned channel = 0;
+        unsigned fftSize = 1024; ///< must be a power of 2
+        Window window = Hann;
+        double overlap = 0.5;    ///< ratio of block overlap, in range [0, 1)
+        Mode mode = Normal;
+        unsigned averages = 8;   ///< number of averaged blocks for `Average` mode
+        bool waterfall = false;  ///< keep spectrum of every block, see `takeColumns()`
+
+        /// Number of samples between starts of consecutive blocks
+        unsigned hop() const;
+    };
+
+    /// Latest result, shared with the worker thread
+    struct Result
+    {
+        QMutex mutex;
+        QVector<double> data;   ///< power in dB, `fftSize/2+1` bins
+        bool fresh = false;     ///< set when there is a new result
+        /// Spectrum of each block since last take, oldest first, in dB
+        std::vector<float> columns;
+        unsigned columnSize = 0; ///< number of bins of a column in `columns`
+    };
+
+    explicit SpectrumAnalyzer(QObject* parent = 0);
+    ~SpectrumAnalyzer();
+
+    /// Changes settings. Calculation is restarted.
+    void setConfig(const Config& config);
+    Config config() const;
+
+    /// Number of channels of the connected stream
+    unsigned numChannels() const;
+
+    /**
+     * Copies latest spectrum to `out` if there is a new one.
+     *
+     * @return false if there is no new spectrum since last call
+     */
+    bool takeSpectrum(QVector<double>& out);
+
+    /**
+     * Moves spectrums of blocks processed since last call to `out`,
+     * one after the other. Only available in `waterfall` mode. If
+     * consumer falls behind oldest ones are dropped.
+     *
+     * @param numBins expected number of bins of a spectrum, columns
+     * of different size (from previous settings) are discarded
+     * @return number of columns
+     */
+    unsigned takeColumns(std::vector<float>& out, unsigned numBins);
+
+signals:
+    void numChannelsChanged(unsigned value);
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    Config _config;
+    unsigned _numChannels;
+    Result result;
+    QThread thread;
+    SpectrumWorker* worker;
+};
+
+#endif // SPECTRUMANALYZER_H
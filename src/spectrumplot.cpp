@@ -0,0 +1,261 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+#include <QLabel>
+
+#include "spectrumplot.h"
+
+/// Display update period in milliseconds
+static const int UPDATE_PERIOD = 33;
+/// Number of spectrums kept in waterfall history
+static const unsigned HISTORY_ROWS = 1024;
+
+SpectrumPlot::SpectrumPlot(Stream* stream, PlotMenu* menu, QWidget* parent) :
+    QWidget(parent)
+{
+    _stream = stream;
+
+    // setup controls
+    for (unsigned n = 256; n <= (1 << 20); n *= 2)
+    {
+        cbSize.addItem(QString::number(n), n);
+    }
+    cbSize.setCurrentIndex(cbSize.findData(1024));
+    cbSize.setToolTip("FFT size");
+
+    cbWindow.addItems({"Rectangular", "Hann", "Blackman"});
+    cbWindow.setCurrentIndex(SpectrumAnalyzer::Hann);
+
+    cbOverlap.addItem("0%", 0.);
+    cbOverlap.addItem("25%", 0.25);
+    cbOverlap.addItem("50%", 0.5);
+    cbOverlap.addItem("75%", 0.75);
+    cbOverlap.addItem("87.5%", 0.875);
+    cbOverlap.setCurrentIndex(2);
+    cbOverlap.setToolTip("Overlap of consecutive FFT blocks");
+
+    cbMode.addItems({"Normal", "Average", "Peak Hold"});
+
+    cbView.addItems({"Spectrum", "Waterfall"});
+    cbView.setToolTip("Display latest spectrum or history of spectrums");
+
+    for (auto sp : {&spMinLevel, &spMaxLevel})
+    {
+        sp->setRange(-400, 400);
+        sp->setDecimals(1);
+        sp->setSuffix(" dB");
+        sp->setKeyboardTracking(false);
+        sp->setVisible(false);
+    }
+    spMinLevel.setValue(-120);
+    spMaxLevel.setValue(0);
+    spMinLevel.setToolTip("Level of the lowest waterfall color");
+    spMaxLevel.setToolTip("Level of the highest waterfall color");
+
+    spSampleRate.setRange(0.001, 1e9);
+    spSampleRate.setDecimals(3);
+    spSampleRate.setValue(1000);
+    spSampleRate.setSuffix(" Hz");
+    spSampleRate.setKeyboardTracking(false);
+    spSampleRate.setToolTip("Sample rate, used for frequency axis");
+
+    pbReset.setText("Reset");
+    pbReset.setToolTip("Restart averaging/peak hold");
+
+    auto controls = new QHBoxLayout();
+    controls->addWidget(&cbChannel);
+    controls->addWidget(&cbSize);
+    controls->addWidget(&cbWindow);
+    controls->addWidget(new QLabel("Overlap:"));
+    controls->addWidget(&cbOverlap);
+    controls->addWidget(&cbMode);
+    controls->addWidget(&spSampleRate);
+    controls->addWidget(&pbReset);
+    controls->addWidget(&cbView);
+    controls->addWidget(&spMinLevel);
+    controls->addWidget(&spMaxLevel);
+    controls->addStretch();
+
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addLayout(controls);
+    layout->addWidget(&plot);
+
+    // setup plot
+    plot.setAxisTitle(QwtPlot::xBottom, "Frequency (Hz)");
+    plot.setAxisTitle(QwtPlot::yLeft, "dB");
+    curve.setPaintAttribute(QwtPlotCurve::FilterPointsAggressive);
+    curve.attach(&plot);
+
+    // connect to menu
+    connect(&menu->darkBackgroundAction, &QAction::toggled,
+            this, &SpectrumPlot::darkBackground);
+    darkBackground(menu->darkBackgroundAction.isChecked());
+
+    for (auto cb : {&cbChannel, &cbSize, &cbWindow, &cbOverlap, &cbMode, &cbView})
+    {
+        connect(cb, &QComboBox::activated, this, &SpectrumPlot::onConfigChanged);
+    }
+    connect(&pbReset, &QPushButton::clicked, this, &SpectrumPlot::onConfigChanged);
+    connect(&spSampleRate, &QDoubleSpinBox::valueChanged, [this]()
+            {
+                updateFreqs();
+                plot.replot();
+            });
+    for (auto sp : {&spMinLevel, &spMaxLevel})
+    {
+        connect(sp, &QDoubleSpinBox::valueChanged, [this]()
+                {
+                    waterfall.setLevels(spMinLevel.value(), spMaxLevel.value());
+                });
+    }
+    waterfall.setLevels(spMinLevel.value(), spMaxLevel.value());
+
+    connect(&analyzer, &SpectrumAnalyzer::numChannelsChanged,
+            this, &SpectrumPlot::onNumChannelsChanged);
+    _stream->connectFollower(&analyzer);
+
+    connect(&updateTimer, &QTimer::timeout, this, &SpectrumPlot::onUpdateTimer);
+    updateTimer.start(UPDATE_PERIOD);
+}
+
+SpectrumPlot::~SpectrumPlot()
+{
+    _stream->disconnectFollower(&analyzer);
+}
+
+void SpectrumPlot::onNumChannelsChanged(unsigned value)
+{
+    int current = cbChannel.currentIndex();
+    cbChannel.clear();
+    for (unsigned ci = 0; ci < value; ci++)
+    {
+        cbChannel.addItem(_stream->channel(ci)->name());
+    }
+    cbChannel.setCurrentIndex(std::max(0, std::min(current, (int) value - 1)));
+    onConfigChanged();
+}
+
+void SpectrumPlot::onConfigChanged()
+{
+    SpectrumAnalyzer::Config config;
+    config.channel = std::max(0, cbChannel.currentIndex());
+    config.fftSize = cbSize.currentData().toUInt();
+    config.window = (SpectrumAnalyzer::Window) cbWindow.currentIndex();
+    config.overlap = cbOverlap.currentData().toDouble();
+    config.mode = (SpectrumAnalyzer::Mode) cbMode.currentIndex();
+    config.waterfall = isWaterfall();
+    analyzer.setConfig(config);
+
+    spMinLevel.setVisible(config.waterfall);
+    spMaxLevel.setVisible(config.waterfall);
+    if (config.waterfall)
+    {
+        curve.detach();
+        waterfall.setSize(config.fftSize / 2 + 1, HISTORY_ROWS);
+        waterfall.attach(&plot);
+    }
+    else
+    {
+        waterfall.detach();
+        waterfall.setSize(0, 0);  // release memory
+        curve.attach(&plot);
+    }
+
+    mags.clear();
+    updateFreqs();
+    plot.replot();
+}
+
+void SpectrumPlot::updateFreqs()
+{
+    unsigned n = analyzer.config().fftSize;
+    double fs = spSampleRate.value();
+
+    freqs.resize(n / 2 + 1);
+    for (int i = 0; i < freqs.size(); i++)
+    {
+        freqs[i] = i * fs / n;
+    }
+    plot.setAxisScale(QwtPlot::xBottom, 0, fs / 2);
+
+    double rowPeriod = analyzer.config().hop() / fs;
+    waterfall.setRange(fs / 2, rowPeriod);
+    if (isWaterfall())
+    {
+        plot.setAxisTitle(QwtPlot::yLeft, "Time (s)");
+        plot.setAxisScale(QwtPlot::yLeft, -(HISTORY_ROWS * rowPeriod), 0);
+    }
+    else
+    {
+        plot.setAxisTitle(QwtPlot::yLeft, "dB");
+        plot.setAxisAutoScale(QwtPlot::yLeft);
+    }
+
+    curve.setRawSamples(freqs.constData(), mags.constData(),
+                        std::min(freqs.size(), mags.size()));
+}
+
+bool SpectrumPlot::isWaterfall() const
+{
+    return cbView.currentIndex() == 1;
+}
+
+void SpectrumPlot::onUpdateTimer()
+{
+    if (!isVisible()) return;
+
+    if (isWaterfall())
+    {
+        unsigned numBins = analyzer.config().fftSize / 2 + 1;
+        unsigned n = analyzer.takeColumns(columns, numBins);
+        if (n)
+        {
+            waterfall.addRows(columns.data(), n);
+            plot.replot();
+        }
+        return;
+    }
+
+    if (!analyzer.takeSpectrum(mags)) return;
+
+    // result might be from previous settings
+    if (mags.size() != freqs.size()) return;
+
+    curve.setRawSamples(freqs.constData(), mags.constData(), mags.size());
+    plot.replot();
+}
+
+void SpectrumPlot::darkBackground(bool enabled)
+{
+    if (enabled)
+    {
+        plot.setCanvasBackground(QBrush(Qt::black));
+        curve.setPen(Qt::yellow);
+    }
+    else
+    {
+        plot.setCanvasBackground(QBrush(Qt::white));
+        curve.setPen(Qt::blue);
+    }
+    plot.replot();
+}
@@ -0,0 +1,87 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SPECTRUMPLOT_H
+#define SPECTRUMPLOT_H
+
+#include <QWidget>
+#include <QComboBox>
+#include <QDoubleSpinBox>
+#include <QPushButton>
+#include <QTimer>
+#include <QVector>
+#include <vector>
+#include <qwt_plot.h>
+#include <qwt_plot_curve.h>
+
+#include "stream.h"
+#include "plotmenu.h"
+#include "spectrumanalyzer.h"
+#include "waterfallitem.h"
+
+/// Displays frequency spectrum of a stream channel, or its history as a waterfall
+class SpectrumPlot : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SpectrumPlot(Stream* stream, PlotMenu* menu, QWidget* parent = 0);
+    ~SpectrumPlot();
+
+public slots:
+    /// Enable/disable dark background
+    void darkBackground(bool enabled);
+
+private:
+    Stream* _stream;
+    SpectrumAnalyzer analyzer;
+
+    QComboBox cbChannel;
+    QComboBox cbSize;
+    QComboBox cbWindow;
+    QComboBox cbOverlap;
+    QComboBox cbMode;
+    QComboBox cbView;
+    QDoubleSpinBox spMinLevel;
+    QDoubleSpinBox spMaxLevel;
+    QDoubleSpinBox spSampleRate;
+    QPushButton pbReset;
+
+    QwtPlot plot;
+    QwtPlotCurve curve;
+    QVector<double> freqs;      ///< X data of `curve`
+    QVector<double> mags;       ///< Y data of `curve`
+    WaterfallItem waterfall;
+    std::vector<float> columns; ///< new rows of `waterfall`
+
+    /// Limits display updates to screen frame rate
+    QTimer updateTimer;
+
+    /// Updates frequency axis data
+    void updateFreqs();
+    /// Returns true if waterfall is displayed
+    bool isWaterfall() const;
+
+private slots:
+    void onNumChannelsChanged(unsigned value);
+    void onConfigChanged();
+    void onUpdateTimer();
+};
+
+#endif // SPECTRUMPLOT_H
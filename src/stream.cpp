@@ -19,6 +19,7 @@
 
 #include "stream.h"
 #include "ringbuffer.h"
+#include "compressedbuffer.h"
 #include "indexbuffer.h"
 #include "linindexbuffer.h"
 
@@ -26,7 +27,9 @@ Stream::Stream(unsigned nc, bool x, unsigned ns) :
     _infoModel(nc)
 {
     _numSamples = ns;
+    _totalSamples = 0;
     _paused = false;
+    _compressed = false;
 
     xAsIndex = true;
     xMin = 0;
@@ -47,7 +50,7 @@ Stream::Stream(unsigned nc, bool x, unsigned ns) :
     // create channels
     for (unsigned i = 0; i < nc; i++)
     {
-        auto c = new StreamChannel(i, xData, new RingBuffer(ns), &_infoModel);
+        auto c = new StreamChannel(i, xData, makeYBuffer(), &_infoModel);
         channels.append(c);
     }
 }
@@ -76,6 +79,11 @@ unsigned Stream::numSamples() const
     return _numSamples;
 }
 
+quint64 Stream::totalSamples() const
+{
+    return _totalSamples;
+}
+
 const StreamChannel* Stream::channel(unsigned index) const
 {
     Q_ASSERT(index < numChannels());
@@ -117,7 +125,7 @@ void Stream::setNumChannels(unsigned nc, bool x)
     {
         for (unsigned i = oldNum; i < nc; i++)
         {
-            auto c = new StreamChannel(i, xData, new RingBuffer(_numSamples), &_infoModel);
+            auto c = new StreamChannel(i, xData, makeYBuffer(), &_infoModel);
             channels.append(c);
         }
     }
@@ -171,6 +179,18 @@ XFrameBuffer* Stream::makeXBuffer() const
     }
 }
 
+WFrameBuffer* Stream::makeYBuffer() const
+{
+    if (_compressed)
+    {
+        return new CompressedBuffer(_numSamples);
+    }
+    else
+    {
+        return new RingBuffer(_numSamples);
+    }
+}
+
 const SamplePack* Stream::applyGainOffset(const SamplePack& pack) const
 {
     Q_ASSERT(infoModel()->gainOrOffsetEn());
@@ -218,6 +238,7 @@ void Stream::feedIn(const SamplePack& pack)
     if (_paused) return;
 
     unsigned ns = pack.numSamples();
+    _totalSamples += ns;
     if (_hasx)
     {
         // TODO: implement XRingBuffer (binary search)
@@ -232,7 +253,7 @@ void Stream::feedIn(const SamplePack& pack)
 
     for (unsigned ci = 0; ci < numChannels(); ci++)
     {
-        auto buf = static_cast<RingBuffer*>(channels[ci]->yData());
+        auto buf = static_cast<WFrameBuffer*>(channels[ci]->yData());
         double* data = (mPack == nullptr) ? pack.data(ci) : mPack->data(ci);
         buf->addSamples(data, ns);
     }
@@ -252,8 +273,38 @@ void Stream::clear()
 {
     for (auto c : channels)
     {
-        static_cast<RingBuffer*>(c->yData())->clear();
+        static_cast<WFrameBuffer*>(c->yData())->clear();
+    }
+}
+
+void Stream::setCompressed(bool enabled)
+{
+    if (enabled == _compressed) return;
+    _compressed = enabled;
+
+    for (auto c : channels)
+    {
+        auto oldBuf = c->yData();
+        auto newBuf = makeYBuffer();
+
+        // copy valid samples to the new buffer
+        unsigned nv = oldBuf->numValid();
+        if (nv)
+        {
+            unsigned start = oldBuf->size() - nv;
+            double* data = new double[nv];
+            for (unsigned i = 0; i < nv; i++)
+            {
+                data[i] = oldBuf->sample(start + i);
+            }
+            newBuf->addSamples(data, nv);
+            delete[] data;
+        }
+
+        c->setY(newBuf);
     }
+
+    emit channelBuffersChanged();
 }
 
 void Stream::setNumSamples(unsigned value)
@@ -264,8 +315,10 @@ void Stream::setNumSamples(unsigned value)
     xData->resize(value);
     for (auto c : channels)
     {
-        static_cast<RingBuffer*>(c->yData())->resize(value);
+        static_cast<WFrameBuffer*>(c->yData())->resize(value);
     }
+
+    emit numSamplesChanged(value);
 }
 
 void Stream::setXAxis(bool asIndex, double min, double max)
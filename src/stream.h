@@ -55,6 +55,9 @@ public:
     unsigned numChannels() const;
 
     unsigned numSamples() const;
+    /// Total number of samples added since creation, including the
+    /// ones that are pushed out of buffers
+    quint64 totalSamples() const;
     const StreamChannel* channel(unsigned index) const;
     StreamChannel* channel(unsigned index);
     QVector<const StreamChannel*> allChannels() const;
@@ -77,6 +80,8 @@ signals:
     void channelAdded(const StreamChannel* chan);
     void channelNameChanged(unsigned channel, QString name); // TODO: does it stay?
     void dataAdded(); ///< emitted when data added to channel man.
+    /// emitted when Y buffers of channels are replaced
+    void channelBuffersChanged();
 
 public slots:
     /// Change number of samples (buffer size)
@@ -89,12 +94,18 @@ public slots:
     /// When paused data feed is ignored
     void pause(bool paused);
 
-    /// Clears buffer data (fills with 0)
+    /// Clears buffer data (marks all samples invalid)
     void clear();
 
+    /// Enable/disable compression of channel buffers. Existing data
+    /// is moved to new buffers.
+    void setCompressed(bool enabled);
+
 private:
     unsigned _numSamples;
+    quint64 _totalSamples;
     bool _paused;
+    bool _compressed;
 
     bool _hasx;
     XFrameBuffer* xData;
@@ -120,6 +131,9 @@ private:
 
     /// Returns a new virtual X buffer for settings
     XFrameBuffer* makeXBuffer() const;
+
+    /// Returns a new Y buffer, compressed or not depending on settings
+    WFrameBuffer* makeYBuffer() const;
 };
 
 
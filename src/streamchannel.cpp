@@ -44,11 +44,27 @@ FrameBuffer* StreamChannel::yData() {return _y;}
 const ChannelInfoModel* StreamChannel::info() const {return _info;}
 void StreamChannel::setX(const XFrameBuffer* x) {_x = x;};
 
+void StreamChannel::setY(FrameBuffer* y)
+{
+    delete _y;
+    _y = y;
+}
+
 double StreamChannel::findValue(double x) const
 {
-    int index = _x->findIndex(x);
+    return findValue(x, _x->findIndex(x));
+}
+
+double StreamChannel::findValue(double x, int index) const
+{
     Q_ASSERT(index < (int) _x->size());
 
+    // no value for samples that are not received yet
+    if (index < (int) (_y->size() - _y->numValid()))
+    {
+        index = XFrameBuffer::OUT_OF_RANGE;
+    }
+
     if (index >= 0)
     {
         // can't do estimation for last sample
@@ -49,6 +49,8 @@ public:
     const FrameBuffer* yData() const;
     const ChannelInfoModel* info() const;
     void setX(const XFrameBuffer* x);
+    /// Replaces the data buffer, takes ownership and deletes the old one
+    void setY(FrameBuffer* y);
 
     /**
      * Returns sample value for `x`.
@@ -57,6 +59,12 @@ public:
      * value is returned when `x` is in between two data points.
      */
     double findValue(double x) const;
+    /**
+     * Same as `findValue(x)` with a known index of `x` in `xData()`,
+     * see `XFrameBuffer::findIndex()`. Useful when looking up values
+     * of multiple channels that share the same X buffer.
+     */
+    double findValue(double x, int index) const;
 
 private:
     unsigned _index;
@@ -0,0 +1,235 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <charconv>
+#include <QApplication>
+#include <QClipboard>
+#include <QContextMenuEvent>
+#include <QFontDatabase>
+#include <QKeyEvent>
+#include <QMenu>
+#include <QPainter>
+#include <QScrollBar>
+
+#include "textrowview.h"
+
+/// Left and right padding of text (px)
+static const int MARGIN = 4;
+
+TextRowView::TextRowView(QWidget* parent) :
+    QAbstractScrollArea(parent), rows(1000)
+{
+    decimals = 6;
+    maxRowWidth = 0;
+
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    viewport()->setAutoFillBackground(true);
+    viewport()->setBackgroundRole(QPalette::Base);
+    updateScrollBars();
+}
+
+unsigned TextRowView::maxRows() const
+{
+    return rows.maxRows();
+}
+
+unsigned TextRowView::numRows() const
+{
+    return rows.numRows();
+}
+
+void TextRowView::setMaxRows(unsigned n)
+{
+    if (std::max(1u, n) == rows.maxRows()) return;
+
+    rows.setMaxRows(n);
+    updateScrollBars();
+    viewport()->update();
+}
+
+void TextRowView::setDecimals(unsigned d)
+{
+    decimals = d;
+    maxRowWidth = 0;
+    updateScrollBars();
+    viewport()->update();
+}
+
+void TextRowView::addRows(const SamplePack& data)
+{
+    if (data.numChannels() != rows.numChannels())
+    {
+        maxRowWidth = 0;
+    }
+
+    auto vbar = verticalScrollBar();
+    bool atBottom = vbar->value() == vbar->maximum();
+
+    unsigned dropped = rows.append(data);
+
+    updateScrollBars();
+    if (atBottom)
+    {
+        vbar->setValue(vbar->maximum());
+    }
+    else
+    {
+        // keep showing the same rows while they are in the buffer
+        vbar->setValue(vbar->value() - int(std::min<unsigned>(dropped, vbar->value())));
+    }
+    viewport()->update();
+}
+
+void TextRowView::clear()
+{
+    rows.clear();
+    maxRowWidth = 0;
+    updateScrollBars();
+    viewport()->update();
+}
+
+QString TextRowView::text() const
+{
+    QString r;
+    char buf[MAX_ROW_LENGTH];
+    for (unsigned i = 0; i < rows.numRows(); i++)
+    {
+        r += QLatin1String(buf, formatRow(i, buf));
+        r += '\n';
+    }
+    return r;
+}
+
+void TextRowView::copy()
+{
+    QApplication::clipboard()->setText(text());
+}
+
+unsigned TextRowView::formatRow(unsigned i, char* buf) const
+{
+    const double* samples = rows.row(i);
+    char* p = buf;
+    char* const end = buf + MAX_ROW_LENGTH;
+    for (unsigned ci = 0; ci < rows.numChannels(); ci++)
+    {
+        if (ci && p < end) *p++ = ' ';
+        auto r = std::to_chars(p, end, samples[ci], std::chars_format::fixed, int(decimals));
+        if (r.ec != std::errc())
+        {
+            break;  // row is too long, cut it
+        }
+        p = r.ptr;
+    }
+    return p - buf;
+}
+
+int TextRowView::visibleRows() const
+{
+    return std::max(1, viewport()->height() / fontMetrics().lineSpacing());
+}
+
+void TextRowView::updateScrollBars()
+{
+    int visible = visibleRows();
+    auto vbar = verticalScrollBar();
+    vbar->setRange(0, std::max(0, int(rows.numRows()) - visible));
+    vbar->setPageStep(visible);
+
+    int width = viewport()->width();
+    auto hbar = horizontalScrollBar();
+    hbar->setRange(0, std::max(0, maxRowWidth + 2 * MARGIN - width));
+    hbar->setPageStep(width);
+    hbar->setSingleStep(fontMetrics().averageCharWidth());
+}
+
+void TextRowView::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(viewport());
+    painter.setFont(font());
+    painter.setPen(palette().color(QPalette::Text));
+
+    const QFontMetrics fm = fontMetrics();
+    const int lineSpacing = fm.lineSpacing();
+    const int x = MARGIN - horizontalScrollBar()->value();
+    const unsigned first = verticalScrollBar()->value();
+    const unsigned last = std::min(rows.numRows(), first + visibleRows() + 1);
+
+    int widest = maxRowWidth;
+    int y = fm.ascent();
+    char buf[MAX_ROW_LENGTH];
+    for (unsigned i = first; i < last; i++)
+    {
+        QString line = QString::fromLatin1(buf, formatRow(i, buf));
+        widest = std::max(widest, fm.horizontalAdvance(line));
+        painter.drawText(x, y, line);
+        y += lineSpacing;
+    }
+
+    // grow horizontal scroll range as wider rows are seen
+    if (widest > maxRowWidth)
+    {
+        maxRowWidth = widest;
+        updateScrollBars();
+    }
+}
+
+void TextRowView::resizeEvent(QResizeEvent* event)
+{
+    auto vbar = verticalScrollBar();
+    bool atBottom = vbar->value() == vbar->maximum();
+
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+
+    if (atBottom) vbar->setValue(vbar->maximum());
+}
+
+void TextRowView::keyPressEvent(QKeyEvent* event)
+{
+    if (event->matches(QKeySequence::Copy))
+    {
+        copy();
+        event->accept();
+    }
+    else
+    {
+        QAbstractScrollArea::keyPressEvent(event);
+    }
+}
+
+void TextRowView::contextMenuEvent(QContextMenuEvent* event)
+{
+    QMenu menu(this);
+    menu.addAction(tr("Copy All"), this, &TextRowView::copy);
+    menu.addAction(tr("Clear"), this, &TextRowView::clear);
+    menu.exec(event->globalPos());
+}
+
+void TextRowView::changeEvent(QEvent* event)
+{
+    QAbstractScrollArea::changeEvent(event);
+    if (event->type() == QEvent::FontChange)
+    {
+        maxRowWidth = 0;
+        updateScrollBars();
+    }
+}
@@ -0,0 +1,87 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEXTROWVIEW_H
+#define TEXTROWVIEW_H
+
+#include <QAbstractScrollArea>
+#include <QString>
+
+#include "rowring.h"
+#include "samplepack.h"
+
+/**
+ * Displays last `maxRows()` samples as lines of text, one line per
+ * sample.
+ *
+ * Samples are kept as numbers in a `RowRing`. Only the visible rows
+ * are converted to text, when painting. So adding data is cheap and
+ * doesn't depend on the number of rows kept.
+ *
+ * View follows the newest rows unless user scrolls up.
+ */
+class TextRowView : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+public:
+    explicit TextRowView(QWidget* parent = 0);
+
+    /// Maximum number of rows kept
+    unsigned maxRows() const;
+    /// Number of rows currently stored
+    unsigned numRows() const;
+    /// Sets maximum number of rows, oldest rows are dropped if necessary
+    void setMaxRows(unsigned n);
+    /// Number of digits after the decimal point
+    void setDecimals(unsigned d);
+    /// Appends samples as new rows. Clears the view if number of
+    /// channels changes.
+    void addRows(const SamplePack& data);
+    /// Returns all stored rows as text, a line per row
+    QString text() const;
+
+public slots:
+    void clear();
+    /// Copies all rows to the clipboard
+    void copy();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void contextMenuEvent(QContextMenuEvent* event) override;
+    void changeEvent(QEvent* event) override;
+
+private:
+    /// Maximum length of a formatted row (characters)
+    static const unsigned MAX_ROW_LENGTH = 4096;
+
+    RowRing rows;
+    unsigned decimals;
+    int maxRowWidth;          ///< widest row painted so far (px)
+
+    /// Formats row `i` into `buf`, returns length
+    unsigned formatRow(unsigned i, char* buf) const;
+    /// Number of rows that fits the viewport
+    int visibleRows() const;
+    void updateScrollBars();
+};
+
+#endif // TEXTROWVIEW_H
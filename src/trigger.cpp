@@ -0,0 +1,196 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+
+#include "trigger.h"
+
+namespace
+{
+/// Number of samples checked at once when searching a condition
+const unsigned CHUNK_SIZE = 16;
+
+/**
+ * Returns the index of the first sample at or after `start` that
+ * satisfies `pred`, returns `n` if there is none.
+ *
+ * Chunks are reduced with a bitwise OR instead of an early exit so
+ * that inner loop can be vectorized.
+ */
+template <typename Pred>
+unsigned findFirst(const double* data, unsigned start, unsigned n, Pred pred)
+{
+    unsigned i = start;
+    for (; i + CHUNK_SIZE <= n; i += CHUNK_SIZE)
+    {
+        bool any = false;
+        for (unsigned j = 0; j < CHUNK_SIZE; j++)
+        {
+            any |= pred(data[i + j]);
+        }
+        if (any) break;
+    }
+
+    for (; i < n; i++)
+    {
+        if (pred(data[i])) return i;
+    }
+    return n;
+}
+}
+
+TriggerDetector::TriggerDetector()
+{
+    reset();
+}
+
+void TriggerDetector::setSpec(const TriggerSpec& spec)
+{
+    _spec = spec;
+    reset();
+}
+
+const TriggerSpec& TriggerDetector::spec() const
+{
+    return _spec;
+}
+
+void TriggerDetector::reset()
+{
+    state = Disarmed;
+    pulseWidth = 0;
+}
+
+int TriggerDetector::scan(const double* data, unsigned n, unsigned acceptFrom)
+{
+    acceptFrom = std::min(acceptFrom, n);
+    track(data, acceptFrom);
+
+    int i = find(data + acceptFrom, n - acceptFrom);
+    return i < 0 ? -1 : i + acceptFrom;
+}
+
+void TriggerDetector::track(const double* data, unsigned n)
+{
+    unsigned pos = 0;
+    while (pos < n)
+    {
+        int i = find(data + pos, n - pos);
+        if (i < 0) break;
+        pos += i + 1;
+    }
+}
+
+int TriggerDetector::find(const double* data, unsigned n)
+{
+    const double level = _spec.level;
+    const double hyst = std::max(_spec.hysteresis, 0.);
+    const double low = std::min(_spec.level, _spec.level2);
+    const double high = std::max(_spec.level, _spec.level2);
+
+    unsigned pos = 0;
+    unsigned pulseStart = 0;    // start of the pulse in this block
+    while (true)
+    {
+        unsigned i;
+        switch (state)
+        {
+            case Disarmed:
+                switch (_spec.mode)
+                {
+                    case TriggerSpec::RisingEdge:
+                    case TriggerSpec::PulseWidth:
+                        i = findFirst(data, pos, n,
+                                      [level, hyst](double x) {return x < level - hyst;});
+                        break;
+                    case TriggerSpec::FallingEdge:
+                        i = findFirst(data, pos, n,
+                                      [level, hyst](double x) {return x > level + hyst;});
+                        break;
+                    case TriggerSpec::Window:
+                        i = findFirst(data, pos, n,
+                                      [low, high, hyst](double x)
+                                      {
+                                          return (x >= low + hyst) & (x <= high - hyst);
+                                      });
+                        break;
+                    case TriggerSpec::Level:
+                    default:
+                        i = pos;
+                        break;
+                }
+                if (i >= n) return -1;
+                state = Armed;
+                pos = i;
+                break;
+
+            case Armed:
+                switch (_spec.mode)
+                {
+                    case TriggerSpec::FallingEdge:
+                        i = findFirst(data, pos, n, [level](double x) {return x <= level;});
+                        break;
+                    case TriggerSpec::Window:
+                        i = findFirst(data, pos, n,
+                                      [low, high](double x) {return (x < low) | (x > high);});
+                        break;
+                    case TriggerSpec::RisingEdge:
+                    case TriggerSpec::Level:
+                    case TriggerSpec::PulseWidth:
+                    default:
+                        i = findFirst(data, pos, n, [level](double x) {return x >= level;});
+                        break;
+                }
+                if (i >= n) return -1;
+                if (_spec.mode != TriggerSpec::PulseWidth)
+                {
+                    state = Disarmed;
+                    return i;
+                }
+                // pulse started
+                state = InPulse;
+                pulseWidth = 0;
+                pulseStart = i;
+                pos = i;
+                break;
+
+            case InPulse:
+                i = findFirst(data, pos, n,
+                              [level, hyst](double x) {return x < level - hyst;});
+                if (i >= n)
+                {
+                    // pulse continues into next block, saturate to prevent overflow
+                    pulseWidth = std::min(pulseWidth + (n - pulseStart), _spec.maxWidth + 1);
+                    return -1;
+                }
+                // pulse ended, signal is low so we are armed for the next pulse
+                state = Armed;
+                pos = i;
+                {
+                    unsigned width = pulseWidth + (i - pulseStart);
+                    if (width >= _spec.minWidth && width <= _spec.maxWidth)
+                    {
+                        return i;
+                    }
+                }
+                break;
+        }
+    }
+}
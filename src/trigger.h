@@ -0,0 +1,92 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+/// Describes a trigger condition on a single channel
+struct TriggerSpec
+{
+    enum Mode
+    {
+        RisingEdge = 0,
+        FallingEdge,
+        Level,        ///< fires while signal is at or above `level`
+        Window,       ///< fires when signal leaves [`level`, `level2`]
+        PulseWidth    ///< fires at the end of a positive pulse with matching width
+    };
+
+    Mode mode = RisingEdge;
+    double level = 0;
+    double level2 = 1;         ///< upper limit in window mode
+    /// Signal must move this much away from the level before re-arming
+    double hysteresis = 0;
+    unsigned minWidth = 1;     ///< minimum pulse width in samples
+    unsigned maxWidth = 100;   ///< maximum pulse width in samples
+};
+
+/**
+ * Scans a signal for a trigger condition.
+ *
+ * State (arming, pulse width) is kept between `scan()` calls so that
+ * consecutive blocks are treated as a continuous signal. Searches are
+ * done in fixed size chunks with branch free comparisons so that the
+ * compiler can vectorize them, only the matching chunk is scanned
+ * sample by sample.
+ */
+class TriggerDetector
+{
+public:
+    TriggerDetector();
+
+    void setSpec(const TriggerSpec& spec);
+    const TriggerSpec& spec() const;
+
+    /// Disarms the detector, a fresh arming condition is required
+    void reset();
+
+    /**
+     * Scans `n` samples and returns the index of the first trigger
+     * point. Samples before `acceptFrom` only update the arming
+     * state. Returns -1 if there is no trigger.
+     *
+     * @note Samples after the returned index are not processed.
+     */
+    int scan(const double* data, unsigned n, unsigned acceptFrom = 0);
+
+private:
+    enum State
+    {
+        Disarmed,   ///< waiting for the arming condition
+        Armed,      ///< waiting for the trigger condition
+        InPulse     ///< pulse width mode: pulse started, waiting for it to end
+    };
+
+    TriggerSpec _spec;
+    State state;
+    unsigned pulseWidth;        ///< width of current pulse so far
+
+    /// Processes samples without firing, only updates state
+    void track(const double* data, unsigned n);
+    /// Scans for a trigger point with an up-to-date state
+    int find(const double* data, unsigned n);
+};
+
+#endif // TRIGGER_H
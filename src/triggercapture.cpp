@@ -0,0 +1,293 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <cmath>
+
+#include "triggercapture.h"
+
+TriggerCapture::TriggerCapture(QObject* parent) :
+    QObject(parent)
+{
+    _channel = 0;
+    _sweep = Auto;
+    _preTrigger = 0.5;
+    _autoTimeout = 100;
+    _numSamples = 1;
+    _enabled = false;
+    _state = Stopped;
+    _numChannels = 0;
+    _triggerPosition = -1;
+    sinceArm = 0;
+    postRemaining = 0;
+    autoTimer.start();
+}
+
+TriggerCapture::~TriggerCapture()
+{
+    qDeleteAll(history);
+    qDeleteAll(display);
+}
+
+void TriggerCapture::setSpec(const TriggerSpec& spec)
+{
+    detector.setSpec(spec);
+    if (_state != Stopped) arm();
+}
+
+TriggerSpec TriggerCapture::spec() const
+{
+    return detector.spec();
+}
+
+void TriggerCapture::setChannel(unsigned channel)
+{
+    _channel = channel;
+    if (_state != Stopped) arm();
+}
+
+unsigned TriggerCapture::channel() const
+{
+    return _channel;
+}
+
+void TriggerCapture::setSweep(Sweep sweep)
+{
+    _sweep = sweep;
+}
+
+TriggerCapture::Sweep TriggerCapture::sweep() const
+{
+    return _sweep;
+}
+
+void TriggerCapture::setPreTrigger(double ratio)
+{
+    _preTrigger = std::min(std::max(ratio, 0.), 1.);
+}
+
+double TriggerCapture::preTrigger() const
+{
+    return _preTrigger;
+}
+
+void TriggerCapture::setAutoTimeout(unsigned ms)
+{
+    _autoTimeout = ms;
+}
+
+void TriggerCapture::setNumSamples(unsigned value)
+{
+    Q_ASSERT(value > 0);
+
+    _numSamples = value;
+    for (auto buf : history) buf->resize(value);
+    for (auto buf : display) buf->resize(value);
+    copyBuffer.resize(value);
+
+    if (_state != Stopped) arm();
+}
+
+unsigned TriggerCapture::numSamples() const
+{
+    return _numSamples;
+}
+
+void TriggerCapture::setEnabled(bool enabled)
+{
+    _enabled = enabled;
+    if (enabled)
+    {
+        arm();
+    }
+    else
+    {
+        setState(Stopped);
+    }
+}
+
+bool TriggerCapture::isEnabled() const
+{
+    return _enabled;
+}
+
+void TriggerCapture::arm()
+{
+    detector.reset();
+    sinceArm = 0;
+    postRemaining = 0;
+    autoTimer.restart();
+    setState(Armed);
+}
+
+TriggerCapture::State TriggerCapture::state() const
+{
+    return _state;
+}
+
+void TriggerCapture::setState(State state)
+{
+    if (state == _state) return;
+
+    _state = state;
+    emit stateChanged(state);
+}
+
+unsigned TriggerCapture::numChannels() const
+{
+    return _numChannels;
+}
+
+const FrameBuffer* TriggerCapture::displayData(unsigned channel) const
+{
+    Q_ASSERT(channel < (unsigned) display.size());
+    return display[channel];
+}
+
+int TriggerCapture::triggerPosition() const
+{
+    return _triggerPosition;
+}
+
+unsigned TriggerCapture::preSamples() const
+{
+    unsigned pre = std::lround(_numSamples * _preTrigger);
+    // at least the trigger point itself is in the post-trigger part
+    return std::min(pre, _numSamples - 1);
+}
+
+void TriggerCapture::createBuffers()
+{
+    qDeleteAll(history);
+    qDeleteAll(display);
+    history.clear();
+    display.clear();
+
+    for (unsigned ci = 0; ci < _numChannels; ci++)
+    {
+        history.append(new RingBuffer(_numSamples));
+        display.append(new RingBuffer(_numSamples));
+    }
+    copyBuffer.resize(_numSamples);
+    _triggerPosition = -1;
+}
+
+void TriggerCapture::setNumChannels(unsigned nc, bool x)
+{
+    _numChannels = nc;
+    createBuffers();
+    if (_state != Stopped) arm();
+
+    Sink::setNumChannels(nc, x);
+    emit numChannelsChanged(nc);
+}
+
+void TriggerCapture::addToHistory(const SamplePack& data, unsigned start, unsigned n)
+{
+    if (n == 0) return;
+
+    for (unsigned ci = 0; ci < _numChannels; ci++)
+    {
+        history[ci]->addSamples(data.data(ci) + start, n);
+    }
+}
+
+void TriggerCapture::publish(int triggerPos)
+{
+    for (unsigned ci = 0; ci < _numChannels; ci++)
+    {
+        auto src = history[ci];
+        unsigned valid = src->numValid();
+        unsigned offset = _numSamples - valid;
+        for (unsigned i = 0; i < valid; i++)
+        {
+            copyBuffer[i] = src->sample(offset + i);
+        }
+
+        display[ci]->clear();
+        if (valid) display[ci]->addSamples(copyBuffer.data(), valid);
+    }
+
+    _triggerPosition = triggerPos;
+    emit captured();
+}
+
+void TriggerCapture::feedIn(const SamplePack& data)
+{
+    if (!_enabled || _state == Stopped || _channel >= _numChannels)
+    {
+        Sink::feedIn(data);
+        return;
+    }
+
+    const unsigned ns = data.numSamples();
+    const double* trig = data.data(_channel);
+
+    unsigned pos = 0;
+    while (pos < ns && _state != Stopped)
+    {
+        if (_state == Capturing)
+        {
+            unsigned n = std::min(postRemaining, ns - pos);
+            addToHistory(data, pos, n);
+            pos += n;
+            postRemaining -= n;
+
+            if (postRemaining == 0)
+            {
+                publish(preSamples());
+                if (_sweep == Single)
+                {
+                    setState(Stopped);
+                }
+                else
+                {
+                    arm();
+                }
+            }
+        }
+        else                    // Armed
+        {
+            unsigned pre = preSamples();
+            unsigned acceptFrom = sinceArm < pre ? pre - sinceArm : 0;
+            int t = detector.scan(trig + pos, ns - pos, acceptFrom);
+
+            unsigned n = t < 0 ? ns - pos : t;
+            addToHistory(data, pos, n);
+            pos += n;
+            sinceArm = std::min(sinceArm + n, _numSamples);
+
+            if (t >= 0)
+            {
+                // trigger point is the first post-trigger sample
+                postRemaining = _numSamples - pre;
+                autoTimer.restart();
+                setState(Capturing);
+            }
+            else if (_sweep == Auto && autoTimer.elapsed() >= _autoTimeout)
+            {
+                publish(-1);
+                autoTimer.restart();
+            }
+        }
+    }
+
+    Sink::feedIn(data);
+}
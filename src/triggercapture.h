@@ -0,0 +1,143 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRIGGERCAPTURE_H
+#define TRIGGERCAPTURE_H
+
+#include <QObject>
+#include <QVector>
+#include <QElapsedTimer>
+
+#include "sink.h"
+#include "ringbuffer.h"
+#include "trigger.h"
+
+/**
+ * Oscilloscope style trigger. Meant to be connected to `Stream` as a
+ * follower.
+ *
+ * Last `numSamples()` samples of all channels are kept in a history
+ * buffer while the selected channel is scanned for the trigger
+ * condition. When it fires, the trigger point is followed for the
+ * post-trigger part of the window and then the whole window is copied
+ * to display buffers and `captured()` is emitted. Display buffers are
+ * only changed on a capture, so they can be plotted while data keeps
+ * flowing.
+ *
+ * A trigger is accepted only after enough samples are received
+ * (since arming) to fill the pre-trigger part of the window.
+ */
+class TriggerCapture : public QObject, public Sink
+{
+    Q_OBJECT
+
+public:
+    enum Sweep
+    {
+        Auto = 0,   ///< capture without trigger if it doesn't fire for a while
+        Normal,     ///< re-arm after each capture
+        Single      ///< stop after first capture, re-arm with `arm()`
+    };
+
+    enum State
+    {
+        Stopped = 0,
+        Armed,      ///< waiting for trigger
+        Capturing   ///< triggered, collecting post-trigger samples
+    };
+
+    explicit TriggerCapture(QObject* parent = 0);
+    ~TriggerCapture();
+
+    void setSpec(const TriggerSpec& spec);
+    TriggerSpec spec() const;
+    /// Sets the channel that is monitored for trigger
+    void setChannel(unsigned channel);
+    unsigned channel() const;
+    void setSweep(Sweep sweep);
+    Sweep sweep() const;
+    /// Sets the ratio of the pre-trigger part of the window, in range [0, 1]
+    void setPreTrigger(double ratio);
+    double preTrigger() const;
+    /// Time to wait for a trigger in `Auto` mode before capturing anyway
+    void setAutoTimeout(unsigned ms);
+    /// Sets capture window size, should match the stream size
+    void setNumSamples(unsigned value);
+    unsigned numSamples() const;
+
+    /// Enables/disables triggering, disabled trigger ignores incoming data
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+    /// Starts waiting for a new trigger. History isn't cleared, but a
+    /// trigger is accepted only after the pre-trigger part is filled
+    /// with samples received since arming.
+    void arm();
+    State state() const;
+
+    /// Number of channels of the connected stream
+    unsigned numChannels() const;
+    /// Returns captured data of a channel
+    const FrameBuffer* displayData(unsigned channel) const;
+    /// Index of trigger point in display data, -1 for untriggered captures
+    int triggerPosition() const;
+
+signals:
+    /// Emitted when display data is updated
+    void captured();
+    void stateChanged(State state);
+    void numChannelsChanged(unsigned value);
+
+protected:
+    // implementations for `Sink`
+    virtual void setNumChannels(unsigned nc, bool x);
+    virtual void feedIn(const SamplePack& data);
+
+private:
+    TriggerDetector detector;
+    unsigned _channel;
+    Sweep _sweep;
+    double _preTrigger;
+    unsigned _autoTimeout;
+    unsigned _numSamples;
+    bool _enabled;
+    State _state;
+    unsigned _numChannels;
+    int _triggerPosition;
+
+    unsigned sinceArm;          ///< samples received since arming
+    unsigned postRemaining;     ///< post-trigger samples waiting to be received
+    QElapsedTimer autoTimer;    ///< time since last capture or arming
+
+    QVector<RingBuffer*> history;
+    QVector<RingBuffer*> display;
+    QVector<double> copyBuffer; ///< used for copying history to display
+
+    void setState(State state);
+    /// Number of samples before the trigger point in a capture window
+    unsigned preSamples() const;
+    /// Adds samples [start, start+n) of all channels to history
+    void addToHistory(const SamplePack& data, unsigned start, unsigned n);
+    /// Copies history to display buffers and emits `captured`
+    void publish(int triggerPos);
+    /// Deletes and re-creates history and display buffers
+    void createBuffers();
+};
+
+#endif // TRIGGERCAPTURE_H
@@ -0,0 +1,229 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+
+#include "triggerpanel.h"
+#include "ui_triggerpanel.h"
+
+#include "setting_defines.h"
+
+TriggerPanel::TriggerPanel(Stream* stream, QWidget *parent) :
+    QWidget(parent),
+    ui(new Ui::TriggerPanel)
+{
+    _stream = stream;
+    ui->setupUi(this);
+
+    _capture.setNumSamples(_stream->numSamples());
+    _capture.setPreTrigger(ui->spPreTrigger->value() / 100.);
+    _capture.setSweep((TriggerCapture::Sweep) ui->cbSweep->currentIndex());
+    _capture.setSpec(editorSpec());
+
+    connect(_stream, &Stream::numSamplesChanged,
+            [this](unsigned value)
+            {
+                _capture.setNumSamples(value);
+            });
+    connect(_stream, &Stream::numChannelsChanged,
+            this, &TriggerPanel::onNumChannelsChanged);
+    connect(&_capture, &TriggerCapture::stateChanged,
+            this, &TriggerPanel::onStateChanged);
+
+    connect(ui->cbEnable, &QCheckBox::toggled, this, &TriggerPanel::onEnableToggled);
+    connect(ui->cbMode, &QComboBox::currentIndexChanged, this, &TriggerPanel::onModeChanged);
+    connect(ui->cbChannel, &QComboBox::currentIndexChanged,
+            [this](int index)
+            {
+                if (index >= 0) _capture.setChannel(index);
+            });
+    connect(ui->cbSweep, &QComboBox::currentIndexChanged,
+            [this](int index)
+            {
+                _capture.setSweep((TriggerCapture::Sweep) index);
+            });
+    connect(ui->spPreTrigger, &QSpinBox::valueChanged,
+            [this](int value)
+            {
+                _capture.setPreTrigger(value / 100.);
+            });
+    connect(ui->pbArm, &QPushButton::clicked, [this]()
+            {
+                if (_capture.isEnabled()) _capture.arm();
+            });
+
+    connect(ui->spLevel, &QDoubleSpinBox::valueChanged, this, &TriggerPanel::updateSpec);
+    connect(ui->spLevel2, &QDoubleSpinBox::valueChanged, this, &TriggerPanel::updateSpec);
+    connect(ui->spHysteresis, &QDoubleSpinBox::valueChanged, this, &TriggerPanel::updateSpec);
+    connect(ui->spMinWidth, &QSpinBox::valueChanged, this, &TriggerPanel::updateSpec);
+    connect(ui->spMaxWidth, &QSpinBox::valueChanged, this, &TriggerPanel::updateSpec);
+
+    onNumChannelsChanged(_stream->numChannels());
+    onModeChanged(ui->cbMode->currentIndex());
+    onStateChanged(_capture.state());
+    ui->pbArm->setEnabled(false);
+}
+
+TriggerPanel::~TriggerPanel()
+{
+    if (_capture.isEnabled())
+    {
+        _stream->disconnectFollower(&_capture);
+    }
+    delete ui;
+}
+
+const TriggerCapture* TriggerPanel::capture() const
+{
+    return &_capture;
+}
+
+bool TriggerPanel::isTriggerEnabled() const
+{
+    return _capture.isEnabled();
+}
+
+void TriggerPanel::onEnableToggled(bool enabled)
+{
+    if (enabled == _capture.isEnabled()) return;
+
+    // trigger is only connected when enabled so that it doesn't cost anything otherwise
+    if (enabled)
+    {
+        _stream->connectFollower(&_capture);
+    }
+    else
+    {
+        _stream->disconnectFollower(&_capture);
+    }
+    _capture.setEnabled(enabled);
+    ui->pbArm->setEnabled(enabled);
+
+    emit triggerEnabledChanged(enabled);
+}
+
+void TriggerPanel::onNumChannelsChanged(unsigned value)
+{
+    int current = ui->cbChannel->currentIndex();
+
+    ui->cbChannel->blockSignals(true);
+    ui->cbChannel->clear();
+    for (unsigned ci = 0; ci < value; ci++)
+    {
+        ui->cbChannel->addItem(QString("Channel %1").arg(ci + 1));
+    }
+    ui->cbChannel->setCurrentIndex(std::min(std::max(current, 0), (int) value - 1));
+    ui->cbChannel->blockSignals(false);
+
+    if (ui->cbChannel->currentIndex() >= 0)
+    {
+        _capture.setChannel(ui->cbChannel->currentIndex());
+    }
+}
+
+void TriggerPanel::onModeChanged(int index)
+{
+    auto mode = (TriggerSpec::Mode) index;
+
+    ui->spLevel2->setEnabled(mode == TriggerSpec::Window);
+    ui->spHysteresis->setEnabled(mode != TriggerSpec::Level);
+    ui->spMinWidth->setEnabled(mode == TriggerSpec::PulseWidth);
+    ui->spMaxWidth->setEnabled(mode == TriggerSpec::PulseWidth);
+
+    updateSpec();
+}
+
+void TriggerPanel::onStateChanged(TriggerCapture::State state)
+{
+    switch (state)
+    {
+        case TriggerCapture::Stopped:
+            ui->lState->setText(tr("Stopped"));
+            break;
+        case TriggerCapture::Armed:
+            ui->lState->setText(tr("Armed"));
+            break;
+        case TriggerCapture::Capturing:
+            ui->lState->setText(tr("Triggered"));
+            break;
+    }
+}
+
+TriggerSpec TriggerPanel::editorSpec() const
+{
+    TriggerSpec spec;
+    spec.mode = (TriggerSpec::Mode) ui->cbMode->currentIndex();
+    spec.level = ui->spLevel->value();
+    spec.level2 = ui->spLevel2->value();
+    spec.hysteresis = ui->spHysteresis->value();
+    spec.minWidth = ui->spMinWidth->value();
+    spec.maxWidth = std::max(ui->spMaxWidth->value(), ui->spMinWidth->value());
+    return spec;
+}
+
+void TriggerPanel::updateSpec()
+{
+    _capture.setSpec(editorSpec());
+}
+
+void TriggerPanel::saveSettings(QSettings* settings)
+{
+    settings->beginGroup(SettingGroup_Trigger);
+    settings->setValue(SG_Trigger_Enabled, ui->cbEnable->isChecked());
+    settings->setValue(SG_Trigger_Sweep, ui->cbSweep->currentIndex());
+    settings->setValue(SG_Trigger_Channel, ui->cbChannel->currentIndex());
+    settings->setValue(SG_Trigger_Mode, ui->cbMode->currentIndex());
+    settings->setValue(SG_Trigger_PreTrigger, ui->spPreTrigger->value());
+    settings->setValue(SG_Trigger_Level, ui->spLevel->value());
+    settings->setValue(SG_Trigger_Level2, ui->spLevel2->value());
+    settings->setValue(SG_Trigger_Hysteresis, ui->spHysteresis->value());
+    settings->setValue(SG_Trigger_MinWidth, ui->spMinWidth->value());
+    settings->setValue(SG_Trigger_MaxWidth, ui->spMaxWidth->value());
+    settings->endGroup();
+}
+
+void TriggerPanel::loadSettings(QSettings* settings)
+{
+    settings->beginGroup(SettingGroup_Trigger);
+    ui->cbSweep->setCurrentIndex(
+        settings->value(SG_Trigger_Sweep, ui->cbSweep->currentIndex()).toInt());
+    int channel = settings->value(SG_Trigger_Channel, ui->cbChannel->currentIndex()).toInt();
+    if (channel >= 0 && channel < ui->cbChannel->count())
+    {
+        ui->cbChannel->setCurrentIndex(channel);
+    }
+    ui->cbMode->setCurrentIndex(
+        settings->value(SG_Trigger_Mode, ui->cbMode->currentIndex()).toInt());
+    ui->spPreTrigger->setValue(
+        settings->value(SG_Trigger_PreTrigger, ui->spPreTrigger->value()).toInt());
+    ui->spLevel->setValue(
+        settings->value(SG_Trigger_Level, ui->spLevel->value()).toDouble());
+    ui->spLevel2->setValue(
+        settings->value(SG_Trigger_Level2, ui->spLevel2->value()).toDouble());
+    ui->spHysteresis->setValue(
+        settings->value(SG_Trigger_Hysteresis, ui->spHysteresis->value()).toDouble());
+    ui->spMinWidth->setValue(
+        settings->value(SG_Trigger_MinWidth, ui->spMinWidth->value()).toInt());
+    ui->spMaxWidth->setValue(
+        settings->value(SG_Trigger_MaxWidth, ui->spMaxWidth->value()).toInt());
+    ui->cbEnable->setChecked(
+        settings->value(SG_Trigger_Enabled, ui->cbEnable->isChecked()).toBool());
+    settings->endGroup();
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRIGGERPANEL_H
+#define TRIGGERPANEL_H
+
+#include <QWidget>
+#include <QSettings>
+
+#include "stream.h"
+#include "triggercapture.h"
+
+namespace Ui {
+class TriggerPanel;
+}
+
+/// Panel for trigger settings, owns the `TriggerCapture`
+class TriggerPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit TriggerPanel(Stream* stream, QWidget *parent = 0);
+    ~TriggerPanel();
+
+    /// Returns the trigger capture, its data should be displayed when enabled
+    const TriggerCapture* capture() const;
+    bool isTriggerEnabled() const;
+
+    /// Stores settings into a `QSettings`
+    void saveSettings(QSettings* settings);
+    /// Loads settings from a `QSettings`.
+    void loadSettings(QSettings* settings);
+
+signals:
+    void triggerEnabledChanged(bool enabled);
+
+private:
+    Ui::TriggerPanel *ui;
+    Stream* _stream;
+    TriggerCapture _capture;
+
+    /// Returns the spec entered in the editor
+    TriggerSpec editorSpec() const;
+
+private slots:
+    void onEnableToggled(bool enabled);
+    void onNumChannelsChanged(unsigned value);
+    void onModeChanged(int index);
+    void onStateChanged(TriggerCapture::State state);
+    void updateSpec();
+};
+
+#endif // TRIGGERPANEL_H
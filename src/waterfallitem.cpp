@@ -0,0 +1,139 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <QPainter>
+
+#include "waterfallitem.h"
+
+WaterfallItem::WaterfallItem()
+{
+    _numBins = 0;
+    binsPerPixel = 1;
+    head = 0;
+    _maxFreq = 1;
+    _rowPeriod = 1;
+    setLevels(-120, 0);
+    setZ(10);
+
+    fillColorTable(colorTable);
+}
+
+int WaterfallItem::rtti() const
+{
+    return Rtti_Waterfall;
+}
+
+void WaterfallItem::setSize(unsigned numBins, unsigned numRows)
+{
+    _numBins = numBins;
+    binsPerPixel = std::max(1u, (numBins + MAX_WIDTH - 1) / MAX_WIDTH);
+    unsigned width = (numBins + binsPerPixel - 1) / binsPerPixel;
+
+    image = QImage(width, numRows, QImage::Format_ARGB32_Premultiplied);
+    clear();
+}
+
+void WaterfallItem::setRange(double maxFreq, double rowPeriod)
+{
+    _maxFreq = maxFreq;
+    _rowPeriod = rowPeriod;
+    itemChanged();
+}
+
+void WaterfallItem::setLevels(double min, double max)
+{
+    levelMin = min;
+    levelScale = max > min ? 255 / (max - min) : 0;
+}
+
+void WaterfallItem::clear()
+{
+    image.fill(Qt::transparent);
+    head = 0;
+}
+
+void WaterfallItem::addRows(const float* data, unsigned n)
+{
+    if (image.isNull()) return;
+
+    // rows that would be overwritten anyway are skipped
+    unsigned numRows = image.height();
+    if (n > numRows)
+    {
+        data += (size_t) (n - numRows) * _numBins;
+        n = numRows;
+    }
+
+    const int width = image.width();
+    for (unsigned r = 0; r < n; r++)
+    {
+        head = (head + numRows - 1) % numRows;
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(head));
+        const float* row = data + (size_t) r * _numBins;
+
+        for (int px = 0; px < width; px++)
+        {
+            unsigned start = px * binsPerPixel;
+            unsigned end = std::min(start + binsPerPixel, _numBins);
+            float value = *std::max_element(row + start, row + end);
+
+            // clamp before converting to int, value may be NaN or infinite
+            double level = (value - levelMin) * levelScale;
+            int index = level > 0 ? (level < 255 ? int(level) : 255) : 0;
+            line[px] = colorTable[index];
+        }
+    }
+}
+
+QRectF WaterfallItem::boundingRect() const
+{
+    double history = image.height() * _rowPeriod;
+    return QRectF(0, -history, _maxFreq, history);
+}
+
+void WaterfallItem::draw(QPainter* painter,
+                         const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                         const QRectF& canvasRect) const
+{
+    Q_UNUSED(canvasRect);
+
+    if (image.isNull()) return;
+
+    const int numRows = image.height();
+    double left = xMap.transform(0);
+    double right = xMap.transform(_maxFreq);
+
+    // ring is drawn in two parts: rows from `head` to the end are the
+    // newer ones, rows before `head` follow them
+    auto drawPart = [&](int firstRow, int count, int rowsAgo)
+        {
+            if (count <= 0) return;
+            double top = yMap.transform(-rowsAgo * _rowPeriod);
+            double bottom = yMap.transform(-(rowsAgo + count) * _rowPeriod);
+            QRectF target(QPointF(left, top), QPointF(right, bottom));
+            QRectF source(0, firstRow, image.width(), count);
+            painter->drawImage(target.normalized(), image, source);
+        };
+
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, false);
+    drawPart(head, numRows - head, 0);
+    drawPart(0, head, numRows - head);
+}
@@ -0,0 +1,82 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WATERFALLITEM_H
+#define WATERFALLITEM_H
+
+#include <QImage>
+#include <QRgb>
+#include <qwt_plot_item.h>
+#include <qwt_scale_map.h>
+
+#include "colormap.h"
+
+/**
+ * Displays a history of spectrums as a waterfall. Newest spectrum
+ * is at the top (Y=0) and older ones go down in negative time.
+ *
+ * Rows are kept in a ring buffered image which is colored when a row
+ * is added, through a lookup table. Adding a row doesn't move the
+ * existing ones, only the starting row of the ring changes. So the
+ * cost of adding a row depends only on its width.
+ *
+ * Spectrums wider than `MAX_WIDTH` are reduced by taking maximum of
+ * neighboring bins.
+ */
+class WaterfallItem : public QwtPlotItem
+{
+public:
+    enum {Rtti_Waterfall = QwtPlotItem::Rtti_PlotUserItem + 2};
+
+    /// Maximum width of the image in pixels
+    static const unsigned MAX_WIDTH = 8192;
+
+    WaterfallItem();
+
+    int rtti() const override;
+
+    /// Sets the number of bins of a spectrum and rows of history, clears
+    void setSize(unsigned numBins, unsigned numRows);
+    /// Sets the frequency of the last bin and time between rows
+    void setRange(double maxFreq, double rowPeriod);
+    /// Sets the dB range of the color map, only affects new rows
+    void setLevels(double min, double max);
+    /// Adds `n` spectrums of `numBins` each, oldest first
+    void addRows(const float* data, unsigned n);
+    void clear();
+
+    QRectF boundingRect() const override;
+    void draw(QPainter* painter,
+              const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+              const QRectF& canvasRect) const override;
+
+private:
+    QImage image;
+    unsigned _numBins;
+    unsigned binsPerPixel;
+    int head;                   ///< image row of the newest spectrum
+    double _maxFreq;
+    double _rowPeriod;
+    double levelMin;
+    double levelScale;          ///< dB to color index
+    QRgb colorTable[COLOR_TABLE_SIZE]; ///< color map lookup table
+};
+
+#endif // WATERFALLITEM_H
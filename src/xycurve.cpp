@@ -0,0 +1,234 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <math.h>
+#include <climits>
+#include <algorithm>
+#include <QPainter>
+#include <QPolygonF>
+
+#include "xycurve.h"
+
+static bool sameMap(const QwtScaleMap& a, const QwtScaleMap& b)
+{
+    return a.s1() == b.s1() && a.s2() == b.s2() &&
+        a.p1() == b.p1() && a.p2() == b.p2();
+}
+
+XYCurve::XYCurve()
+{
+    _x = nullptr;
+    _y = nullptr;
+    _color = Qt::blue;
+    _decay = 0;
+    numNew = 0;
+    fadePending = false;
+    setZ(20);                   // same as curves
+    setItemAttribute(QwtPlotItem::AutoScale, true);
+}
+
+int XYCurve::rtti() const
+{
+    return Rtti_XYCurve;
+}
+
+void XYCurve::setData(const FrameBuffer* x, const FrameBuffer* y)
+{
+    Q_ASSERT(x == nullptr || y == nullptr || x->size() == y->size());
+
+    _x = x;
+    _y = y;
+    clear();
+    itemChanged();
+}
+
+void XYCurve::setColor(QColor color)
+{
+    _color = color;
+    clear();
+    itemChanged();
+}
+
+void XYCurve::setPersistence(double decay)
+{
+    Q_ASSERT(decay >= 0 && decay < 1);
+
+    _decay = decay;
+    clear();
+    itemChanged();
+}
+
+void XYCurve::addSamples(unsigned n)
+{
+    numNew += n;
+    fadePending = true;
+}
+
+void XYCurve::clear()
+{
+    persistImage = QImage();
+}
+
+unsigned XYCurve::firstValid() const
+{
+    // the later of the two, in case one channel was just added
+    unsigned nx = _x->size() - _x->numValid();
+    unsigned ny = _y->size() - _y->numValid();
+    return std::max(nx, ny);
+}
+
+QRectF XYCurve::boundingRect() const
+{
+    if (_x == nullptr || _y == nullptr) return QRectF(1, 1, -2, -2); // invalid
+
+    auto xLim = _x->limits();
+    auto yLim = _y->limits();
+    return QRectF(xLim.start, yLim.start,
+                  xLim.end - xLim.start, yLim.end - yLim.start);
+}
+
+void XYCurve::draw(QPainter* painter,
+                   const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                   const QRectF& canvasRect) const
+{
+    if (_x == nullptr || _y == nullptr) return;
+
+    const unsigned size = std::min(_x->size(), _y->size());
+    const unsigned start = firstValid();
+    QRect rect = canvasRect.toAlignedRect();
+    if (start >= size || rect.isEmpty()) return;
+
+    if (_decay <= 0)
+    {
+        drawSamples(painter, xMap, yMap, rect, start, size);
+        numNew = 0;
+        return;
+    }
+
+    bool reuse = !persistImage.isNull() && rect == lastRect &&
+        sameMap(xMap, lastXMap) && sameMap(yMap, lastYMap);
+
+    QPainter p;
+    if (reuse)
+    {
+        p.begin(&persistImage);
+        p.translate(-rect.topLeft());
+
+        if (fadePending)
+        {
+            // scale down intensity of older drawings
+            p.setCompositionMode(QPainter::CompositionMode_DestinationIn);
+            p.fillRect(rect, QColor(0, 0, 0, qRound(255 * _decay)));
+            p.setCompositionMode(QPainter::CompositionMode_SourceOver);
+        }
+    }
+    else
+    {
+        persistImage = QImage(rect.size(), QImage::Format_ARGB32_Premultiplied);
+        persistImage.fill(Qt::transparent);
+        p.begin(&persistImage);
+        p.translate(-rect.topLeft());
+
+        numNew = size;          // start over from all samples
+    }
+
+    unsigned first = size - std::min(numNew, size);
+    // connect to the last drawn sample
+    if (reuse && first > 0) first--;
+    first = std::max(first, start);
+    if (first < size)
+    {
+        drawSamples(&p, xMap, yMap, rect, first, size);
+    }
+    p.end();
+
+    numNew = 0;
+    fadePending = false;
+    lastXMap = xMap;
+    lastYMap = yMap;
+    lastRect = rect;
+
+    painter->drawImage(rect.topLeft(), persistImage);
+}
+
+void XYCurve::drawSamples(QPainter* painter,
+                          const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                          const QRect& rect, unsigned start, unsigned end) const
+{
+    if (end - start > DENSITY_THRESHOLD)
+    {
+        drawDensity(painter, xMap, yMap, rect, start, end);
+    }
+    else
+    {
+        drawLines(painter, xMap, yMap, start, end);
+    }
+}
+
+void XYCurve::drawLines(QPainter* painter,
+                        const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                        unsigned start, unsigned end) const
+{
+    QPolygonF points;
+    points.reserve(end - start);
+
+    // skip samples that fall into the same pixel as previous
+    QPoint lastPixel(INT_MIN, INT_MIN);
+    for (unsigned i = start; i < end; i++)
+    {
+        QPointF p(xMap.transform(_x->sample(i)), yMap.transform(_y->sample(i)));
+        QPoint pixel = p.toPoint();
+        if (pixel == lastPixel && i != end - 1) continue;
+
+        lastPixel = pixel;
+        points.append(p);
+    }
+
+    painter->setPen(_color);
+    painter->drawPolyline(points);
+}
+
+void XYCurve::drawDensity(QPainter* painter,
+                          const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                          const QRect& rect, unsigned start, unsigned end) const
+{
+    const int w = rect.width();
+    const int h = rect.height();
+    hitMap.reset(w, h);
+    hitMap.add(_x, _y, start, end,
+               HitMap::Axis::fromRange(xMap.s1(), xMap.s2(), xMap.p1(), xMap.p2(), rect.left()),
+               HitMap::Axis::fromRange(yMap.s1(), yMap.s2(), yMap.p1(), yMap.p2(), rect.top()));
+    const quint32 maxHits = hitMap.maxCount();
+    if (maxHits == 0) return;
+
+    QImage image(w, h, QImage::Format_ARGB32_Premultiplied);
+    for (int y = 0; y < h; y++)
+    {
+        auto line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        const quint32* row = hitMap.row(y);
+        for (int x = 0; x < w; x++)
+        {
+            int a = HitMap::alpha(row[x], maxHits);
+            line[x] = a ? qPremultiply(qRgba(_color.red(), _color.green(), _color.blue(), a)) : 0;
+        }
+    }
+
+    painter->drawImage(rect.topLeft(), image);
+}
@@ -0,0 +1,103 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef XYCURVE_H
+#define XYCURVE_H
+
+#include <QColor>
+#include <QImage>
+#include <qwt_plot_item.h>
+#include <qwt_scale_map.h>
+
+#include "framebuffer.h"
+#include "hitmap.h"
+
+/**
+ * Plots one frame buffer against another.
+ *
+ * Up to `DENSITY_THRESHOLD` samples are drawn as lines, with
+ * consecutive samples that fall into the same pixel skipped. More
+ * samples are drawn as a density image instead. Hits of each pixel
+ * are counted and shown with an intensity relative to the maximum
+ * count. So cost doesn't depend on how long the lines are.
+ *
+ * With persistence enabled, drawing accumulates into an image. Only
+ * samples reported by `addSamples()` are drawn on each update and
+ * older drawings fade. Any change of scale maps or canvas size
+ * restarts the image from the whole buffer.
+ */
+class XYCurve : public QwtPlotItem
+{
+public:
+    enum {Rtti_XYCurve = QwtPlotItem::Rtti_PlotUserItem + 3};
+
+    /// Sample count above which density image is drawn instead of lines
+    static const unsigned DENSITY_THRESHOLD = 20000;
+
+    XYCurve();
+
+    int rtti() const override;
+
+    /// Sets the data for X and Y, buffers must be of same size
+    void setData(const FrameBuffer* x, const FrameBuffer* y);
+    void setColor(QColor color);
+    /**
+     * Enables persistence. `decay` is the ratio of intensity that is
+     * kept at each update, in range (0, 1). 0 disables persistence.
+     */
+    void setPersistence(double decay);
+    /// Reports that `n` new samples are added since last update
+    void addSamples(unsigned n);
+    /// Clears persistence image
+    void clear();
+
+    QRectF boundingRect() const override;
+    void draw(QPainter* painter,
+              const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+              const QRectF& canvasRect) const override;
+
+private:
+    const FrameBuffer* _x;
+    const FrameBuffer* _y;
+    QColor _color;
+    double _decay;
+
+    mutable QImage persistImage;
+    mutable unsigned numNew;   ///< samples not yet drawn to `persistImage`
+    mutable bool fadePending;
+    mutable QwtScaleMap lastXMap, lastYMap;
+    mutable QRect lastRect;
+    mutable HitMap hitMap;     ///< for density drawing
+
+    /// Index of the first valid sample
+    unsigned firstValid() const;
+    /// Draws samples `[start, end)` as lines or density image
+    void drawSamples(QPainter* painter,
+                     const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                     const QRect& rect, unsigned start, unsigned end) const;
+    void drawLines(QPainter* painter,
+                   const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                   unsigned start, unsigned end) const;
+    void drawDensity(QPainter* painter,
+                     const QwtScaleMap& xMap, const QwtScaleMap& yMap,
+                     const QRect& rect, unsigned start, unsigned end) const;
+};
+
+#endif // XYCURVE_H
@@ -0,0 +1,178 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+#include <QLabel>
+
+#include "xyplot.h"
+
+XYPlot::XYPlot(Stream* stream, PlotMenu* menu, QWidget* parent) :
+    QWidget(parent)
+{
+    _stream = stream;
+    _scheduler = nullptr;
+    updatePending = false;
+    lastTotalSamples = _stream->totalSamples();
+
+    // setup controls
+    cbXChannel.setToolTip("Channel for X axis");
+    cbYChannel.setToolTip("Channel for Y axis");
+
+    cbPersistence.addItem("Off", 0.);
+    cbPersistence.addItem("Short", 0.7);
+    cbPersistence.addItem("Long", 0.95);
+    cbPersistence.setToolTip("Keep fading traces of older data");
+
+    auto controls = new QHBoxLayout();
+    controls->addWidget(new QLabel("X:"));
+    controls->addWidget(&cbXChannel);
+    controls->addWidget(new QLabel("Y:"));
+    controls->addWidget(&cbYChannel);
+    controls->addWidget(new QLabel("Persistence:"));
+    controls->addWidget(&cbPersistence);
+    controls->addStretch();
+
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addLayout(controls);
+    layout->addWidget(&plot);
+
+    curve.attach(&plot);
+
+    // connect to menu
+    connect(&menu->darkBackgroundAction, &QAction::toggled,
+            this, &XYPlot::darkBackground);
+    darkBackground(menu->darkBackgroundAction.isChecked());
+
+    connect(&cbXChannel, &QComboBox::activated, this, &XYPlot::onChannelsChanged);
+    connect(&cbYChannel, &QComboBox::activated, this, &XYPlot::onChannelsChanged);
+    connect(&cbPersistence, &QComboBox::activated, [this]()
+            {
+                curve.setPersistence(cbPersistence.currentData().toDouble());
+                plot.replot();
+            });
+
+    connect(_stream, &Stream::dataAdded, this, &XYPlot::onDataAdded);
+    connect(_stream, &Stream::numChannelsChanged, this, &XYPlot::onNumChannelsChanged);
+    connect(_stream, &Stream::channelBuffersChanged, this, &XYPlot::onChannelsChanged);
+    connect(_stream, &Stream::numSamplesChanged, this, &XYPlot::onChannelsChanged);
+
+    onNumChannelsChanged(_stream->numChannels());
+    // second channel against the first one by default
+    if (_stream->numChannels() > 1)
+    {
+        cbYChannel.setCurrentIndex(1);
+        onChannelsChanged();
+    }
+}
+
+void XYPlot::onNumChannelsChanged(unsigned value)
+{
+    for (auto cb : {&cbXChannel, &cbYChannel})
+    {
+        int current = cb->currentIndex();
+        cb->clear();
+        for (unsigned ci = 0; ci < value; ci++)
+        {
+            cb->addItem(_stream->channel(ci)->name());
+        }
+        cb->setCurrentIndex(std::max(0, std::min(current, (int) value - 1)));
+    }
+    onChannelsChanged();
+}
+
+void XYPlot::onChannelsChanged()
+{
+    int xi = cbXChannel.currentIndex();
+    int yi = cbYChannel.currentIndex();
+    unsigned nc = _stream->numChannels();
+
+    if (xi < 0 || yi < 0 || xi >= (int) nc || yi >= (int) nc)
+    {
+        curve.setData(nullptr, nullptr);
+    }
+    else
+    {
+        curve.setData(_stream->channel(xi)->yData(), _stream->channel(yi)->yData());
+        curve.setColor(_stream->infoModel()->color(yi));
+        plot.setAxisTitle(QwtPlot::xBottom, _stream->channel(xi)->name());
+        plot.setAxisTitle(QwtPlot::yLeft, _stream->channel(yi)->name());
+    }
+    updatePlot();
+}
+
+void XYPlot::updatePlot()
+{
+    quint64 total = _stream->totalSamples();
+    curve.addSamples(std::min<quint64>(total - lastTotalSamples, _stream->numSamples()));
+    lastTotalSamples = total;
+
+    plot.replot();
+    updatePending = false;
+}
+
+void XYPlot::setReplotScheduler(ReplotScheduler* scheduler)
+{
+    if (_scheduler != nullptr)
+    {
+        disconnect(_scheduler, nullptr, this, nullptr);
+    }
+    _scheduler = scheduler;
+
+    if (_scheduler != nullptr)
+    {
+        connect(_scheduler, &ReplotScheduler::frame, this, &XYPlot::onFrame);
+    }
+
+    if (updatePending) updatePlot();
+}
+
+void XYPlot::onDataAdded()
+{
+    if (_scheduler == nullptr)
+    {
+        updatePlot();
+    }
+    else
+    {
+        updatePending = true;
+        _scheduler->schedule();
+    }
+}
+
+void XYPlot::onFrame()
+{
+    if (updatePending) updatePlot();
+}
+
+void XYPlot::darkBackground(bool enabled)
+{
+    if (enabled)
+    {
+        plot.setCanvasBackground(QBrush(Qt::black));
+    }
+    else
+    {
+        plot.setCanvasBackground(QBrush(Qt::white));
+    }
+    plot.replot();
+}
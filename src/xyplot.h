@@ -0,0 +1,69 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef XYPLOT_H
+#define XYPLOT_H
+
+#include <QWidget>
+#include <QComboBox>
+#include <qwt_plot.h>
+
+#include "stream.h"
+#include "plotmenu.h"
+#include "xycurve.h"
+#include "replotscheduler.h"
+
+/// Displays a stream channel against another channel
+class XYPlot : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit XYPlot(Stream* stream, PlotMenu* menu, QWidget* parent = 0);
+
+public slots:
+    /// Enable/disable dark background
+    void darkBackground(bool enabled);
+    /// Update at the frame rate of `scheduler`, `nullptr` to update for each data
+    void setReplotScheduler(ReplotScheduler* scheduler);
+
+private:
+    Stream* _stream;
+    ReplotScheduler* _scheduler;
+    bool updatePending;
+    quint64 lastTotalSamples;   ///< stream sample count at last update
+
+    QComboBox cbXChannel;
+    QComboBox cbYChannel;
+    QComboBox cbPersistence;
+
+    QwtPlot plot;
+    XYCurve curve;
+
+private slots:
+    void updatePlot();
+    void onDataAdded();
+    void onFrame();
+    void onNumChannelsChanged(unsigned value);
+    /// Updates curve data from selected channels
+    void onChannelsChanged();
+};
+
+#endif // XYPLOT_H
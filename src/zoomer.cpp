@@ -25,6 +25,8 @@
 #include <QtMath>
 #include <QPainter>
 #include <QPainterPath>
+#include <QFontMetrics>
+#include <QRegion>
 #include <algorithm>
 
 static const int VALUE_POINT_DIAM = 4;
@@ -34,6 +36,11 @@ Zoomer::Zoomer(QWidget* widget, bool doReplot) :
     ScrollZoomer(widget)
 {
     is_panning = false;
+    lastXBuffer = nullptr;
+    lastIndex = 0;
+    cachedX = 0;
+    cachedFound = false;
+    cacheValid = false;
 
     setTrackerMode(AlwaysOn);
 
@@ -141,14 +148,15 @@ QList<const StreamChannel*> Zoomer::visChannels() const
 
 const double ValueLabelHeight = 12; // TODO: calculate
 
-struct ChannelValue
+double ChannelValue::top() const
 {
-    const StreamChannel* ch;
-    double value;
-    double y;
-    double top() const {return y;};
-    double bottom() const {return y + ValueLabelHeight;};
-};
+    return y;
+}
+
+double ChannelValue::bottom() const
+{
+    return y + ValueLabelHeight;
+}
 
 static void layoutValues(QList<ChannelValue>& values)
 {
@@ -251,18 +259,29 @@ static void layoutValues(QList<ChannelValue>& values)
     } while (!groups.isEmpty());
 };
 
-void Zoomer::drawValues(QPainter* painter) const
+bool Zoomer::findValues(QList<ChannelValue>& values, double& x) const
 {
     auto tpos = trackerPosition();
-    if (tpos.x() < 0) return;   // cursor not on window
+    if (tpos.x() < 0) return false;   // cursor not on window
 
     // find Y values for current cursor X position
-    double x = invTransform(tpos).x();
+    x = invTransform(tpos).x();
     auto channels = visChannels();
-    QList<ChannelValue> values;
+    const XFrameBuffer* xBuffer = nullptr;
+    int index = XFrameBuffer::OUT_OF_RANGE;
     for (auto ch : channels)
     {
-        double value = ch->findValue(x);
+        // channels usually share the same X buffer
+        if (ch->xData() != xBuffer)
+        {
+            xBuffer = ch->xData();
+            int hint = xBuffer == lastXBuffer ? lastIndex : 0;
+            index = xBuffer->findIndexNear(x, hint);
+            lastXBuffer = xBuffer;
+            lastIndex = std::max(index, 0);
+        }
+
+        double value = ch->findValue(x, index);
         if (!std::isnan(value))
         {
             auto point = transform(QPointF(x, value));
@@ -270,14 +289,71 @@ void Zoomer::drawValues(QPainter* painter) const
         }
     }
 
+    layoutValues(values);
+    return true;
+}
+
+QRegion Zoomer::trackerMask() const
+{
+    if (isActive() || dispChannels.isEmpty())
+    {
+        return ScrollZoomer::trackerMask();
+    }
+
+    // cache values for the draw that follows mask update
+    cachedValues.clear();
+    cachedPos = trackerPosition();
+    cachedFound = findValues(cachedValues, cachedX);
+    cacheValid = true;
+
+    const double x = cachedX;
+    const QList<ChannelValue>& values = cachedValues;
+    if (!cachedFound || values.isEmpty()) return QRegion();
+
+    // vertical line
+    const QRect pRect = pickArea().boundingRect().toRect();
+    int px = trackerPosition().x();
+    QRegion mask(px - 1, pRect.top(), 3, pRect.height());
+
+    // points and labels
+    QFontMetrics fm(trackerFont());
+    const int textHeight = fm.height();
+    for (auto value : values)
+    {
+        auto point = transform(QPointF(x, value.value));
+        int textWidth = fm.horizontalAdvance(QString("%1").arg(value.value));
+        mask += QRect(point.x() - VALUE_POINT_DIAM - 1, point.y() - VALUE_POINT_DIAM - 1,
+                      2 * VALUE_POINT_DIAM + 3, 2 * VALUE_POINT_DIAM + 3);
+        mask += QRect(point.x() + VALUE_TEXT_MARGIN - 1, value.y - textHeight / 2 - 1,
+                      textWidth + 3, textHeight + 3);
+    }
+
+    return mask;
+}
+
+void Zoomer::drawValues(QPainter* painter) const
+{
+    double x;
+    QList<ChannelValue> values;
+    if (cacheValid && cachedPos == trackerPosition())
+    {
+        // values are only valid for a single draw, data may change later
+        cacheValid = false;
+        if (!cachedFound) return;
+        values = cachedValues;
+        x = cachedX;
+    }
+    else if (!findValues(values, x))
+    {
+        return;
+    }
+
     // TODO should keep?
     if (values.isEmpty())
     {
         return;
     }
 
-    layoutValues(values);
-
     painter->save();
 
     // draw vertical line
@@ -285,7 +361,7 @@ void Zoomer::drawValues(QPainter* painter) const
     linePen.setStyle(Qt::DotLine);
     painter->setPen(linePen);
     const QRect pRect = pickArea().boundingRect().toRect();
-    int px = tpos.x();
+    int px = trackerPosition().x();
     painter->drawLine(px, pRect.top(), px, pRect.bottom());
 
     // draw sample values
@@ -27,6 +27,16 @@
 #include "scrollzoomer.h"
 #include "streamchannel.h"
 
+/// Value of a channel at the tracker position and its label position
+struct ChannelValue
+{
+    const StreamChannel* ch;
+    double value;
+    double y;
+    double top() const;
+    double bottom() const;
+};
+
 class Zoomer : public ScrollZoomer
 {
     Q_OBJECT
@@ -46,6 +56,8 @@ protected:
     QwtText trackerTextF(const QPointF &pos) const override;
     /// Re-implemented for sample value tracker
     QRect trackerRect(const QFont&) const override;
+    /// Re-implemented to only cover value line and labels
+    QRegion trackerMask() const override;
     /// Re-implemented for alpha background
     void drawRubberBand(QPainter* painter) const override;
     /// Re-implemented to draw sample values
@@ -64,9 +76,29 @@ private:
     QPointF pan_point;
     /// displayed channels for value tracking
     QVector<const StreamChannel*> dispChannels;
+    /// X buffer of last value lookup
+    mutable const XFrameBuffer* lastXBuffer;
+    /// Index found in last value lookup, used as a search hint
+    mutable int lastIndex;
+    /// Values found by `trackerMask()`, reused by the following draw
+    mutable QList<ChannelValue> cachedValues;
+    mutable double cachedX;
+    /// Tracker position `cachedValues` were found for
+    mutable QPoint cachedPos;
+    /// `findValues()` result for `cachedPos`
+    mutable bool cachedFound;
+    mutable bool cacheValid;
 
     /// Get a list of visible channels
     QList<const StreamChannel*> visChannels() const;
+    /**
+     * Finds values of visible channels at the tracker position and
+     * lays out their labels. Index of X is searched once for each X
+     * buffer.
+     *
+     * @return false if tracker is not on the plot
+     */
+    bool findValues(QList<ChannelValue>& values, double& x) const;
     /// Draw sample values
     void drawValues(QPainter* painter) const;
     /// Returns trackerRect for value tracker
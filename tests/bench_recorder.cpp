@@ -0,0 +1,109 @@
+/*
+  Copyright © 2018 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * Compares CSV formatting speed of `QTextStream` (previous recorder
+ * implementation) and `CsvFormatter`. Output of both must be
+ * identical. Fails if `CsvFormatter` isn't at least 5 times faster.
+ */
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include "csvformatter.h"
+
+#define NUM_CHANNELS 64
+#define NUM_ROWS     20000
+#define PACK_ROWS    1000     // NUM_ROWS must be a multiple
+#define DECIMALS     6
+#define MIN_SPEEDUP  5.
+
+int main()
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1000., 1000.);
+    std::vector<std::vector<double>> data(NUM_CHANNELS, std::vector<double>(NUM_ROWS));
+    std::vector<const double*> columns;
+    for (auto& column : data)
+    {
+        for (auto& v : column) v = dist(gen);
+        columns.push_back(column.data());
+    }
+
+    QElapsedTimer timer;
+
+    // QTextStream
+    QBuffer streamOut;
+    streamOut.open(QIODevice::WriteOnly);
+    timer.start();
+    {
+        QTextStream stream(&streamOut);
+        stream.setRealNumberNotation(QTextStream::FixedNotation);
+        stream.setRealNumberPrecision(DECIMALS);
+        for (unsigned i = 0; i < NUM_ROWS; i++)
+        {
+            for (unsigned ci = 0; ci < NUM_CHANNELS; ci++)
+            {
+                stream << columns[ci][i];
+                if (ci != NUM_CHANNELS-1) stream << ",";
+            }
+            stream << "\n";
+        }
+    }
+    qint64 streamTime = timer.nsecsElapsed();
+
+    // CsvFormatter
+    QBuffer csvOut;
+    csvOut.open(QIODevice::WriteOnly);
+    timer.restart();
+    {
+        // same as recorder, buffer is reused for each pack
+        CsvFormatter csv;
+        csv.setDecimals(DECIMALS);
+        csv.setSeparator(",");
+        std::vector<const double*> pack(NUM_CHANNELS);
+        for (unsigned i = 0; i < NUM_ROWS; i += PACK_ROWS)
+        {
+            for (unsigned ci = 0; ci < NUM_CHANNELS; ci++) pack[ci] = columns[ci] + i;
+            csv.clear();
+            csv.appendRows(pack.data(), NUM_CHANNELS, PACK_ROWS);
+            csvOut.write(csv.data(), csv.size());
+        }
+    }
+    qint64 csvTime = timer.nsecsElapsed();
+
+    if (streamOut.data() != csvOut.data())
+    {
+        printf("Output of CsvFormatter doesn't match QTextStream!\n");
+        return 1;
+    }
+
+    double speedup = double(streamTime) / csvTime;
+    printf("%d rows x %d channels, %lld bytes\n", NUM_ROWS, NUM_CHANNELS,
+           (long long) csvOut.size());
+    printf("QTextStream:  %8.1f ms\n", streamTime / 1e6);
+    printf("CsvFormatter: %8.1f ms\n", csvTime / 1e6);
+    printf("Speedup:      %8.1fx\n", speedup);
+
+    return speedup >= MIN_SPEEDUP ? 0 : 1;
+}
@@ -20,12 +20,16 @@
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include "catch.hpp"
 
+#include <vector>
+
 #include "samplepack.h"
 #include "source.h"
 #include "indexbuffer.h"
 #include "linindexbuffer.h"
 #include "ringbuffer.h"
+#include "compressedbuffer.h"
 #include "readonlybuffer.h"
+#include "bytering.h"
 
 #include "test_helpers.h"
 
@@ -231,6 +235,43 @@ TEST_CASE("LinIndexBuffer", "[memory, buffer]")
     REQUIRE(buf.findIndex(-0.01) == XFrameBuffer::OUT_OF_RANGE);
 }
 
+/// X buffer with arbitrary increasing values, uses default `findIndex`
+class VectorXBuffer : public XFrameBuffer
+{
+public:
+    VectorXBuffer(std::vector<double> values) : data(values) {}
+    unsigned size() const override {return data.size();}
+    double sample(unsigned i) const override {return data[i];}
+    Range limits() const override {return {data.front(), data.back()};}
+    void resize(unsigned n) override {data.resize(n);}
+
+private:
+    std::vector<double> data;
+};
+
+TEST_CASE("default XFrameBuffer::findIndex", "[memory, buffer]")
+{
+    VectorXBuffer buf({-2., 0., 0.5, 0.5, 3., 10., 11.});
+
+    REQUIRE(buf.findIndex(-2.) == 0);
+    REQUIRE(buf.findIndex(-1.) == 0);
+    REQUIRE(buf.findIndex(0.25) == 1);
+    REQUIRE(buf.findIndex(0.5) == 3); // last of equal values
+    REQUIRE(buf.findIndex(9.99) == 4);
+    REQUIRE(buf.findIndex(11.) == 6);
+    REQUIRE(buf.findIndex(11.01) == XFrameBuffer::OUT_OF_RANGE);
+    REQUIRE(buf.findIndex(-2.01) == XFrameBuffer::OUT_OF_RANGE);
+
+    // result shouldn't depend on hint
+    for (double x : {-3., -2., -1., 0., 0.5, 1., 3., 5., 10.5, 11., 12.})
+    {
+        for (int hint = -1; hint <= 8; hint++)
+        {
+            REQUIRE(buf.findIndexNear(x, hint) == buf.findIndex(x));
+        }
+    }
+}
+
 TEST_CASE("RingBuffer sizing", "[memory, buffer]")
 {
     RingBuffer buf(10);
@@ -358,6 +399,252 @@ TEST_CASE("RingBuffer clear", "[memory, buffer]")
     REQUIRE(lim.end == 0.);
 }
 
+TEST_CASE("RingBuffer valid sample count", "[memory, buffer]")
+{
+    RingBuffer buf(10);
+    double values[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    REQUIRE(buf.numValid() == 0);
+
+    buf.addSamples(values, 3);
+    REQUIRE(buf.numValid() == 3);
+
+    buf.addSamples(values, 10);
+    REQUIRE(buf.numValid() == 10);
+
+    buf.clear();
+    REQUIRE(buf.numValid() == 0);
+
+    buf.addSamples(values, 4);
+    buf.resize(2);
+    REQUIRE(buf.numValid() == 2);
+    REQUIRE(buf.sample(0) == 3);
+    REQUIRE(buf.sample(1) == 4);
+
+    buf.resize(20);
+    REQUIRE(buf.numValid() == 2);
+    REQUIRE(buf.sample(17) == 0);
+    REQUIRE(buf.sample(18) == 3);
+    REQUIRE(buf.sample(19) == 4);
+}
+
+TEST_CASE("RingBuffer limits should exclude invalid samples", "[memory, buffer]")
+{
+    RingBuffer buf(10);
+    double values[5] = {5, 6, 7, 8, 9};
+
+    buf.addSamples(values, 3);
+    auto lim = buf.limits();
+    REQUIRE(lim.start == 5.);
+    REQUIRE(lim.end == 7.);
+
+    // wrap around the end of the array
+    buf.addSamples(values, 5);
+    buf.addSamples(values, 5);
+    lim = buf.limits();
+    REQUIRE(lim.start == 5.);
+    REQUIRE(lim.end == 9.);
+
+    buf.clear();
+    buf.addSamples(&values[4], 1);
+    lim = buf.limits();
+    REQUIRE(lim.start == 9.);
+    REQUIRE(lim.end == 9.);
+}
+
+TEST_CASE("CompressedBuffer should match RingBuffer", "[memory, buffer]")
+{
+    const unsigned size = 3000;
+    CompressedBuffer cbuf(size);
+    RingBuffer rbuf(size);
+
+    REQUIRE(cbuf.size() == size);
+    REQUIRE(cbuf.numValid() == 0);
+    REQUIRE(cbuf.sample(0) == 0);
+
+    // integer values
+    double ivalues[700];
+    for (unsigned i = 0; i < 700; i++)
+    {
+        ivalues[i] = (i % 50) * 1000 - 20000;
+    }
+    // non integer values including some repeating ones
+    double fvalues[700];
+    for (unsigned i = 0; i < 700; i++)
+    {
+        fvalues[i] = (i % 7 == 0) ? 1.5 : i * 0.1 - 3.3;
+    }
+
+    for (unsigned k = 0; k < 12; k++)
+    {
+        double* values = (k % 3) ? ivalues : fvalues;
+        cbuf.addSamples(values, 700);
+        rbuf.addSamples(values, 700);
+
+        REQUIRE(cbuf.numValid() == rbuf.numValid());
+        for (unsigned i = 0; i < size; i++)
+        {
+            REQUIRE(cbuf.sample(i) == rbuf.sample(i));
+        }
+        REQUIRE(cbuf.limits().start == rbuf.limits().start);
+        REQUIRE(cbuf.limits().end == rbuf.limits().end);
+    }
+}
+
+/// Checks `rangeLimits` of a buffer against limits calculated from samples
+static void checkRangeLimits(const FrameBuffer& buf, unsigned start, unsigned end)
+{
+    Range r = buf.FrameBuffer::rangeLimits(start, end);
+    Range lim = buf.rangeLimits(start, end);
+    REQUIRE(lim.start == r.start);
+    REQUIRE(lim.end == r.end);
+}
+
+TEST_CASE("range limits", "[memory, buffer]")
+{
+    const unsigned size = 3000;
+    RingBuffer rbuf(size);
+    CompressedBuffer cbuf(size);
+
+    double values[1300];
+    for (unsigned i = 0; i < 1300; i++)
+    {
+        values[i] = (i % 7 == 0) ? 1.5 : ((i * 37) % 101) * 0.1 - 3.3;
+    }
+
+    // partially valid buffer
+    rbuf.addSamples(values, 1300);
+    cbuf.addSamples(values, 1300);
+    for (unsigned end : {1u, 1700u, 1701u, 2200u, 3000u})
+    {
+        for (unsigned start : {0u, 1000u, 1699u, 1700u, 1900u})
+        {
+            if (start >= end) continue;
+            checkRangeLimits(rbuf, start, end);
+            checkRangeLimits(cbuf, start, end);
+        }
+    }
+
+    // full and wrapped around, multiple compressed blocks
+    for (unsigned k = 0; k < 4; k++)
+    {
+        rbuf.addSamples(values, 1300);
+        cbuf.addSamples(values, 1300);
+    }
+    for (unsigned start : {0u, 1u, 1023u, 1024u, 1500u, 2999u})
+    {
+        for (unsigned end : {1500u, 2047u, 2048u, 2500u, 3000u})
+        {
+            if (start >= end) continue;
+            checkRangeLimits(rbuf, start, end);
+            checkRangeLimits(cbuf, start, end);
+        }
+    }
+
+    ReadOnlyBuffer robuf(&rbuf);
+    checkRangeLimits(robuf, 0, size);
+    checkRangeLimits(robuf, 100, 101);
+    checkRangeLimits(robuf, 1234, 2345);
+}
+
+TEST_CASE("CompressedBuffer memory usage", "[memory, buffer]")
+{
+    const unsigned size = 20 * CompressedBuffer::BLOCK_SIZE;
+    CompressedBuffer buf(size);
+
+    double values[size];
+    for (unsigned i = 0; i < size; i++)
+    {
+        values[i] = i % 100;
+    }
+    buf.addSamples(values, size);
+
+    REQUIRE(buf.numValid() == size);
+    REQUIRE(buf.memoryUsage() < size * sizeof(double) / 2);
+    REQUIRE(buf.sample(size-1) == (size-1) % 100);
+}
+
+TEST_CASE("CompressedBuffer clear and resize", "[memory, buffer]")
+{
+    CompressedBuffer buf(2000);
+    double values[2000];
+    for (unsigned i = 0; i < 2000; i++)
+    {
+        values[i] = i + 0.25;
+    }
+
+    buf.addSamples(values, 1500);
+    REQUIRE(buf.numValid() == 1500);
+    REQUIRE(buf.sample(499) == 0);
+    REQUIRE(buf.sample(500) == 0.25);
+    REQUIRE(buf.sample(1999) == 1499.25);
+
+    buf.resize(1000);
+    REQUIRE(buf.numValid() == 1000);
+    REQUIRE(buf.sample(0) == 500.25);
+    REQUIRE(buf.sample(999) == 1499.25);
+    REQUIRE(buf.limits().start == 500.25);
+    REQUIRE(buf.limits().end == 1499.25);
+
+    buf.resize(4000);
+    REQUIRE(buf.numValid() == 1000);
+    REQUIRE(buf.sample(2999) == 0);
+    REQUIRE(buf.sample(3000) == 500.25);
+
+    buf.clear();
+    REQUIRE(buf.numValid() == 0);
+    REQUIRE(buf.sample(3999) == 0);
+
+    // more samples than size at once
+    buf.resize(100);
+    buf.addSamples(values, 2000);
+    REQUIRE(buf.numValid() == 100);
+    REQUIRE(buf.sample(0) == 1900.25);
+    REQUIRE(buf.sample(99) == 1999.25);
+}
+
+TEST_CASE("ByteRing", "[memory, buffer]")
+{
+    ByteRing ring(4);
+
+    REQUIRE(ring.capacity() == 4);
+    REQUIRE(ring.begin() == 0);
+    REQUIRE(ring.end() == 0);
+
+    ring.append("abc", 3);
+    REQUIRE(ring.begin() == 0);
+    REQUIRE(ring.end() == 3);
+    REQUIRE(ring.byte(0) == 'a');
+    REQUIRE(ring.byte(2) == 'c');
+
+    ring.mark(1, ByteRing::SyncByte);
+    ring.mark(1, ByteRing::FrameStart);
+    ring.mark(5, ByteRing::Error); // out of range, ignored
+    REQUIRE(ring.marks(0) == 0);
+    REQUIRE(ring.marks(1) == (ByteRing::SyncByte | ByteRing::FrameStart));
+
+    // wrap around
+    ring.append("def", 3);
+    REQUIRE(ring.begin() == 2);
+    REQUIRE(ring.end() == 6);
+    REQUIRE(ring.byte(2) == 'c');
+    REQUIRE(ring.byte(3) == 'd');
+    REQUIRE(ring.byte(5) == 'f');
+    // overwritten bytes lose their marks
+    REQUIRE(ring.marks(5) == 0);
+
+    // more than capacity
+    ring.append("0123456", 7);
+    REQUIRE(ring.begin() == 9);
+    REQUIRE(ring.end() == 13);
+    REQUIRE(ring.byte(9) == '3');
+    REQUIRE(ring.byte(12) == '6');
+
+    ring.clear();
+    REQUIRE(ring.begin() == 13);
+    REQUIRE(ring.end() == 13);
+}
+
 TEST_CASE("ReadOnlyBuffer", "[memory, buffer]")
 {
     IndexBuffer source(10);
@@ -0,0 +1,158 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+#include <QThread>
+
+#include "asyncsink.h"
+
+#include "catch.hpp"
+#include "test_helpers.h"
+
+/// Records first sample of each pack, optionally slowly
+class RecordingSink : public Sink
+{
+public:
+    std::vector<double> received;
+    unsigned delayMs = 0;
+    unsigned numChannels = 0;
+
+protected:
+    void feedIn(const SamplePack& data) override
+    {
+        if (delayMs) QThread::msleep(delayMs);
+        received.push_back(data.data(0)[0]);
+    }
+
+    void setNumChannels(unsigned nc, bool x) override
+    {
+        numChannels = nc;
+        Sink::setNumChannels(nc, x);
+    }
+};
+
+static void feedPacks(TestSource& source, unsigned num)
+{
+    for (unsigned i = 0; i < num; i++)
+    {
+        SamplePack pack(1, 1);
+        pack.data(0)[0] = i;
+        source._feed(pack);
+    }
+}
+
+TEST_CASE("async sink delivers all packs in order", "[async]")
+{
+    TestSource source(1, false);
+    RecordingSink sink;
+    sink.delayMs = 1;
+    AsyncSink async(4, AsyncSink::Block);
+
+    async.connectFollower(&sink);
+    source.connectSink(&async);
+    REQUIRE(sink.numChannels == 1);
+
+    feedPacks(source, 50);
+    async.flush();
+
+    REQUIRE(sink.received.size() == 50);
+    for (unsigned i = 0; i < 50; i++)
+    {
+        REQUIRE(sink.received[i] == i);
+    }
+    REQUIRE(async.numDropped() == 0);
+    REQUIRE(async.maxQueueDepth() <= 4);
+    REQUIRE(async.queueDepth() == 0);
+
+    // number of channels change is delivered after data
+    source._setNumChannels(3, false);
+    REQUIRE(sink.numChannels == 3);
+    source.disconnect(&async);
+}
+
+TEST_CASE("async sink drop policies", "[async]")
+{
+    TestSource source(1, false);
+    RecordingSink sink;
+    sink.delayMs = 20;
+
+    SECTION("drop newest")
+    {
+        AsyncSink async(2, AsyncSink::DropNewest);
+        async.connectFollower(&sink);
+        source.connectSink(&async);
+
+        feedPacks(source, 10);
+        async.flush();
+
+        REQUIRE(async.numDropped() > 0);
+        REQUIRE(sink.received.size() + async.numDropped() == 10);
+        REQUIRE(sink.received[0] == 0);
+        source.disconnect(&async);
+    }
+
+    SECTION("drop oldest")
+    {
+        AsyncSink async(2, AsyncSink::DropOldest);
+        async.connectFollower(&sink);
+        source.connectSink(&async);
+
+        feedPacks(source, 10);
+        async.flush();
+
+        REQUIRE(async.numDropped() > 0);
+        REQUIRE(sink.received.size() + async.numDropped() == 10);
+        REQUIRE(sink.received.back() == 9);
+        source.disconnect(&async);
+    }
+}
+
+TEST_CASE("async sink idle handler", "[async]")
+{
+    TestSource source(1, false);
+    RecordingSink sink;
+    AsyncSink async;
+    async.connectFollower(&sink);
+    source.connectSink(&async);
+
+    std::atomic<unsigned> idleCalls(0);
+    std::atomic<unsigned> receivedAtIdle(0);
+    async.setIdleHandler(10, [&]()
+    {
+        // runs on the worker thread, after delivered packs
+        receivedAtIdle = sink.received.size();
+        idleCalls++;
+    });
+
+    feedPacks(source, 3);
+    for (int i = 0; i < 100 && idleCalls == 0; i++)
+    {
+        QThread::msleep(10);
+    }
+    REQUIRE(idleCalls > 0);
+    REQUIRE(receivedAtIdle == 3);
+
+    // no calls after removal
+    async.setIdleHandler(0, {});
+    unsigned calls = idleCalls;
+    QThread::msleep(50);
+    REQUIRE(idleCalls == calls);
+
+    source.disconnect(&async);
+}
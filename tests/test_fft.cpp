@@ -0,0 +1,86 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "fft.h"
+
+#include "catch.hpp"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+TEST_CASE("RealFFT should match DFT", "[fft]")
+{
+    for (unsigned n : {4u, 8u, 32u, 256u})
+    {
+        std::vector<double> input(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            input[i] = sin(i * 0.3) + (i % 5) - 2;
+        }
+
+        RealFFT fft(n);
+        REQUIRE(fft.size() == n);
+        std::vector<double> re(n / 2 + 1), im(n / 2 + 1);
+        fft.transform(input.data(), re.data(), im.data());
+
+        for (unsigned k = 0; k <= n / 2; k++)
+        {
+            std::complex<double> sum = 0;
+            for (unsigned i = 0; i < n; i++)
+            {
+                sum += input[i] * std::polar(1., -2 * M_PI * k * i / n);
+            }
+            REQUIRE(re[k] == Approx(sum.real()).margin(1e-9));
+            REQUIRE(im[k] == Approx(sum.imag()).margin(1e-9));
+        }
+    }
+}
+
+TEST_CASE("RealFFT power spectrum of a sine", "[fft]")
+{
+    const unsigned n = 1024;
+    const unsigned bin = 100;
+    std::vector<double> input(n), power(n / 2 + 1);
+    for (unsigned i = 0; i < n; i++)
+    {
+        input[i] = 2 * cos(2 * M_PI * bin * i / n);
+    }
+
+    RealFFT fft(n);
+    fft.powerSpectrum(input.data(), power.data());
+
+    // |X| = A * N / 2
+    REQUIRE(power[bin] == Approx(n * n));
+    REQUIRE(power[bin + 1] < 1e-6);
+    REQUIRE(power[0] < 1e-6);
+}
+
+TEST_CASE("RealFFT sizes", "[fft]")
+{
+    REQUIRE(RealFFT::isPowerOf2(1024));
+    REQUIRE(RealFFT::isPowerOf2(1 << 20));
+    REQUIRE(!RealFFT::isPowerOf2(1000));
+    REQUIRE(!RealFFT::isPowerOf2(0));
+}
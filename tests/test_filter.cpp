@@ -0,0 +1,293 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cmath>
+#include <vector>
+
+#include "filter.h"
+#include "channelfilters.h"
+
+#include "catch.hpp"
+#include "test_helpers.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#ifndef M_SQRT1_2
+#define M_SQRT1_2 0.70710678118654752440
+#endif
+
+/// Returns amplitude of a filter output for a sine input, after settling
+static double sineGain(Filter* filter, double freq, double fs)
+{
+    const unsigned n = 4000;
+    std::vector<double> data(n);
+    for (unsigned i = 0; i < n; i++)
+    {
+        data[i] = sin(2 * M_PI * freq * i / fs);
+    }
+    filter->process(data.data(), data.data(), n);
+
+    double peak = 0;
+    for (unsigned i = n / 2; i < n; i++)
+    {
+        peak = std::max(peak, std::fabs(data[i]));
+    }
+    return peak;
+}
+
+TEST_CASE("biquad low pass filter", "[filter]")
+{
+    FilterSpec spec;
+    spec.type = FilterSpec::LowPass;
+    spec.sampleRate = 1000;
+    spec.frequency = 50;
+    spec.order = 2;
+
+    Filter* f = Filter::create(spec);
+    REQUIRE(f != nullptr);
+
+    REQUIRE(sineGain(f, 5, 1000) == Approx(1).epsilon(0.01));
+    f->reset();
+    // -3dB at cutoff
+    REQUIRE(sineGain(f, 50, 1000) == Approx(M_SQRT1_2).epsilon(0.02));
+    f->reset();
+    REQUIRE(sineGain(f, 400, 1000) < 0.001);
+
+    delete f;
+}
+
+TEST_CASE("biquad notch filter", "[filter]")
+{
+    FilterSpec spec;
+    spec.type = FilterSpec::Notch;
+    spec.sampleRate = 1000;
+    spec.frequency = 50;
+    spec.q = 5;
+
+    Filter* f = Filter::create(spec);
+    REQUIRE(sineGain(f, 50, 1000) < 0.01);
+    f->reset();
+    REQUIRE(sineGain(f, 200, 1000) == Approx(1).epsilon(0.02));
+    delete f;
+}
+
+TEST_CASE("FIR filters", "[filter]")
+{
+    FilterSpec spec;
+    spec.type = FilterSpec::MovingAverage;
+    spec.order = 4;
+
+    Filter* f = Filter::create(spec);
+    double data[6] = {4, 4, 4, 4, 8, 8};
+    f->process(data, data, 6);
+    REQUIRE(data[0] == 1);
+    REQUIRE(data[3] == 4);
+    REQUIRE(data[5] == 6);
+    delete f;
+
+    spec.type = FilterSpec::FirLowPass;
+    spec.sampleRate = 1000;
+    spec.frequency = 50;
+    spec.order = 101;
+    f = Filter::create(spec);
+    REQUIRE(sineGain(f, 5, 1000) == Approx(1).epsilon(0.01));
+    f->reset();
+    REQUIRE(sineGain(f, 300, 1000) < 0.01);
+    delete f;
+}
+
+TEST_CASE("filter state is kept across blocks", "[filter]")
+{
+    std::vector<double> input(1000);
+    for (unsigned i = 0; i < input.size(); i++)
+    {
+        input[i] = sin(i * 0.1) + (i % 7);
+    }
+
+    FilterSpec specs[2];
+    specs[0].type = FilterSpec::HighPass;
+    specs[0].order = 3;
+    specs[1].type = FilterSpec::FirLowPass;
+    specs[1].order = 31;
+
+    for (auto& spec : specs)
+    {
+        Filter* whole = Filter::create(spec);
+        Filter* split = Filter::create(spec);
+
+        std::vector<double> a = input, b = input;
+        whole->process(a.data(), a.data(), a.size());
+        // uneven block sizes
+        unsigned pos = 0, block = 1;
+        while (pos < b.size())
+        {
+            unsigned n = std::min<unsigned>(block, b.size() - pos);
+            split->process(&b[pos], &b[pos], n);
+            pos += n;
+            block = block * 3 % 97 + 1;
+        }
+
+        for (unsigned i = 0; i < a.size(); i++)
+        {
+            REQUIRE(b[i] == Approx(a[i]));
+        }
+
+        delete whole;
+        delete split;
+    }
+}
+
+TEST_CASE("filter spec serialization", "[filter]")
+{
+    FilterSpec spec;
+    spec.type = FilterSpec::BandPass;
+    spec.sampleRate = 2000;
+    spec.frequency = 123.5;
+    spec.q = 2.5;
+    spec.order = 3;
+
+    FilterSpec r = FilterSpec::deserialize(spec.serialize());
+    REQUIRE(r.type == spec.type);
+    REQUIRE(r.sampleRate == spec.sampleRate);
+    REQUIRE(r.frequency == spec.frequency);
+    REQUIRE(r.q == spec.q);
+    REQUIRE(r.order == spec.order);
+
+    REQUIRE(FilterSpec::deserialize("garbage").type == FilterSpec::None);
+    // cutoff above nyquist
+    REQUIRE(FilterSpec::deserialize("lowpass,100,60,1,1").type == FilterSpec::None);
+}
+
+TEST_CASE("channel filters decimation", "[filter, stream]")
+{
+    TestSource source(2, false);
+    ChannelFilters filters;
+    TestSink sink;
+
+    source.connectSink(&filters);
+    filters.connectSink(&sink);
+    REQUIRE(sink.numChannels() == 2);
+
+    filters.setDecimation(3);
+
+    SamplePack pack(5, 2);
+    source._feed(pack);         // keeps 0, 3
+    REQUIRE(sink.totalFed == 2);
+    source._feed(pack);         // keeps 6, 9 -> 1, 4
+    REQUIRE(sink.totalFed == 4);
+    source._feed(pack);         // keeps 12 -> 2
+    REQUIRE(sink.totalFed == 5);
+
+    SamplePack small(1, 2);
+    source._feed(small);        // 15 -> 0
+    REQUIRE(sink.totalFed == 6);
+    source._feed(small);
+    source._feed(small);
+    REQUIRE(sink.totalFed == 6);
+    source._feed(small);
+    REQUIRE(sink.totalFed == 7);
+}
+
+/// Collects all fed samples of each channel
+class CollectingSink : public Sink
+{
+public:
+    std::vector<double> x;
+    std::vector<std::vector<double>> y;
+
+protected:
+    void setNumChannels(unsigned nc, bool hasX) override
+    {
+        y.resize(nc);
+        Sink::setNumChannels(nc, hasX);
+    }
+
+    void feedIn(const SamplePack& data) override
+    {
+        for (unsigned i = 0; i < data.numSamples(); i++)
+        {
+            if (data.hasX()) x.push_back(data.xData()[i]);
+            for (unsigned ci = 0; ci < data.numChannels(); ci++)
+            {
+                y[ci].push_back(data.data(ci)[i]);
+            }
+        }
+    }
+};
+
+TEST_CASE("channel filters with varying pack sizes", "[filter, stream]")
+{
+    TestSource source(2, true);
+    ChannelFilters filters;
+    CollectingSink sink;
+
+    source.connectSink(&filters);
+    filters.connectFollower(&sink);
+
+    FilterSpec spec;
+    spec.type = FilterSpec::MovingAverage;
+    spec.order = 4;
+    filters.setFilter(0, spec);
+    filters.setDecimation(2);
+
+    // output buffer is grown and reused, packs shouldn't leak into each other
+    const unsigned sizes[] = {5, 12, 3, 1, 20, 7};
+    std::vector<double> input;
+    for (unsigned n : sizes)
+    {
+        SamplePack pack(n, 2, true);
+        for (unsigned i = 0; i < n; i++)
+        {
+            double v = input.size();
+            pack.xData()[i] = v;
+            pack.data(0)[i] = v * v;
+            pack.data(1)[i] = -v;
+            input.push_back(v);
+        }
+        source._feed(pack);
+    }
+
+    std::vector<double> expected(input.size());
+    for (unsigned i = 0; i < input.size(); i++) expected[i] = input[i] * input[i];
+    Filter* reference = Filter::create(spec);
+    reference->process(expected.data(), expected.data(), expected.size());
+    delete reference;
+
+    REQUIRE(sink.x.size() == (input.size() + 1) / 2);
+    for (unsigned i = 0; i < sink.x.size(); i++)
+    {
+        REQUIRE(sink.x[i] == input[2 * i]);
+        REQUIRE(sink.y[0][i] == Approx(expected[2 * i]));
+        REQUIRE(sink.y[1][i] == -input[2 * i]);
+    }
+
+    // without filters, decimated directly from input
+    filters.setFilter(0, FilterSpec());
+    sink.x.clear();
+    SamplePack pack(4, 2, true);
+    for (unsigned i = 0; i < 4; i++)
+    {
+        pack.xData()[i] = i;
+        pack.data(1)[i] = 10 + i;
+    }
+    source._feed(pack);
+    REQUIRE(sink.x.size() == 2);
+}
@@ -0,0 +1,153 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cmath>
+
+#include "mathexpression.h"
+#include "mathchannels.h"
+
+#include "catch.hpp"
+#include "test_helpers.h"
+
+/// Compiles and evaluates given expression for a 3 channel pack
+static double eval(const QString& text, unsigned sample = 0)
+{
+    SamplePack pack(4, 3);
+    for (unsigned ci = 0; ci < 3; ci++)
+    {
+        for (unsigned i = 0; i < 4; i++)
+        {
+            pack.data(ci)[i] = (ci + 1) * (i + 1);
+        }
+    }
+
+    MathExpression expr;
+    REQUIRE(expr.compile(text, 3));
+    double out[4];
+    expr.evaluate(pack, out);
+    return out[sample];
+}
+
+TEST_CASE("math expression operators", "[math]")
+{
+    REQUIRE(eval("1 + 2 * 3") == 7);
+    REQUIRE(eval("(1 + 2) * 3") == 9);
+    REQUIRE(eval("2 ^ 3 ^ 2") == 512);
+    REQUIRE(eval("-2 ^ 2") == -4);
+    REQUIRE(eval("2 ^ -1") == 0.5);
+    REQUIRE(eval("10 / 4 - 1") == 1.5);
+    REQUIRE(eval("1e3 + .5") == 1000.5);
+    REQUIRE(eval("max(1, min(5, 3))") == 3);
+    REQUIRE(eval("pow(2, 10)") == 1024);
+    REQUIRE(eval("cos(pi)") == Approx(-1));
+}
+
+TEST_CASE("math expression channels", "[math]")
+{
+    // ch0 = 1,2,3,4  ch1 = 2,4,6,8  ch2 = 3,6,9,12
+    REQUIRE(eval("ch0", 2) == 3);
+    REQUIRE(eval("ch2 - ch1", 3) == 4);
+    REQUIRE(eval("ch1*0.5 - 40", 1) == -38);
+    REQUIRE(eval("sqrt(ch0^2 + ch1^2)", 0) == Approx(std::sqrt(5.)));
+    REQUIRE(eval("2 / ch1", 3) == 0.25);
+    REQUIRE(eval("-ch0 + CH1", 0) == 1);
+}
+
+TEST_CASE("math expression errors", "[math]")
+{
+    MathExpression expr;
+    QString error;
+
+    REQUIRE(!expr.compile("", 2, &error));
+    REQUIRE(!error.isEmpty());
+    REQUIRE(!expr.compile("1 +", 2));
+    REQUIRE(!expr.compile("(1 + 2", 2));
+    REQUIRE(!expr.compile("ch2", 2));
+    REQUIRE(!expr.compile("foo(1)", 2));
+    REQUIRE(!expr.compile("bar", 2));
+    REQUIRE(!expr.compile("max(1)", 2));
+    REQUIRE(!expr.compile("1 2", 2));
+    REQUIRE(!expr.isValid());
+
+    REQUIRE(expr.compile("ch1", 2));
+    REQUIRE(expr.isValid());
+}
+
+TEST_CASE("math channels append derived channels", "[math, stream]")
+{
+    TestSource source(2, false);
+    MathChannels math;
+    TestSink sink;
+
+    TestSink follower;
+
+    source.connectSink(&math);
+    math.connectSink(&sink);
+    math.connectFollower(&follower);
+    REQUIRE(sink.numChannels() == 2);
+    REQUIRE(follower.numChannels() == 2);
+
+    REQUIRE(math.setExpressions({"ch0 + ch1", "ch5"}) == false);
+    REQUIRE(math.numDerived() == 2);
+    REQUIRE(sink.numChannels() == 4);
+    // followers receive extended packs
+    REQUIRE(follower.numChannels() == 4);
+
+    // feeding data
+    SamplePack pack(3, 2);
+    for (unsigned i = 0; i < 3; i++)
+    {
+        pack.data(0)[i] = i;
+        pack.data(1)[i] = 10;
+    }
+
+    class CheckSink : public TestSink
+    {
+    public:
+        double last[4];
+        void feedIn(const SamplePack& data)
+        {
+            for (unsigned ci = 0; ci < 4; ci++)
+            {
+                last[ci] = data.data(ci)[data.numSamples()-1];
+            }
+            TestSink::feedIn(data);
+        }
+    } check;
+    math.connectSink(&check);
+
+    source._feed(pack);
+    REQUIRE(sink.totalFed == 3);
+    REQUIRE(follower.totalFed == 3);
+    REQUIRE(check.last[0] == 2);
+    REQUIRE(check.last[1] == 10);
+    REQUIRE(check.last[2] == 12);
+    REQUIRE(std::isnan(check.last[3]));
+
+    // more input channels make the invalid expression valid
+    source._setNumChannels(6, false);
+    REQUIRE(sink.numChannels() == 8);
+    REQUIRE(follower.numChannels() == 8);
+
+    // no expressions, pass through
+    REQUIRE(math.setExpressions({}));
+    REQUIRE(sink.numChannels() == 6);
+    REQUIRE(follower.numChannels() == 6);
+}
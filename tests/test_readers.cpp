@@ -100,6 +100,31 @@ TEST_CASE("reading data with AsciiReader", "[reader, ascii]")
     REQUIRE(sink.totalFed == 3);
 }
 
+TEST_CASE("AsciiReader should count parsing errors", "[reader, ascii]")
+{
+    QBuffer bufferDev;
+    AsciiReader reader(&bufferDev);
+    reader.enable(true);
+
+    TestSink sink;
+    reader.connectSink(&sink);
+
+    REQUIRE(reader.errorCounts().isEmpty());
+
+    // first line is discarded by the reader
+    bufferDev.open(QIODevice::ReadWrite);
+    bufferDev.write("0,1,3\n0,1,3\nx,1,3\n0,y,3\n0,1,z\n0,1,3\n");
+    bufferDev.seek(0);
+
+    QSignalSpy spy(&bufferDev, SIGNAL(readyRead()));
+    REQUIRE(spy.wait(READYREAD_TIMEOUT));
+    REQUIRE(sink.totalFed == 2);
+
+    auto errors = reader.errorCounts();
+    REQUIRE(errors.size() == 1);
+    REQUIRE(errors.value("Data parsing error") == 3);
+}
+
 TEST_CASE("AsciiReader shouldn't read when disabled", "[reader, ascii]")
 {
     QBuffer bufferDev;
@@ -20,8 +20,17 @@
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include "catch.hpp"
 
+#include <vector>
+#include <limits>
+#include <QDateTime>
 #include <QDir>
+#include <QTextStream>
+#include <QThread>
 #include "datarecorder.h"
+#include "binaryrecording.h"
+#include "csvformatter.h"
+#include "compressedfile.h"
+#include "asyncsink.h"
 #include "test_helpers.h"
 
 #define TEST_FILE_NAME   "sp_test_recording.csv"
@@ -105,3 +114,494 @@ TEST_CASE("test recording multiple channels", "[recorder]")
     // cleanup
     if (QFile::exists(fileName)) QFile::remove(fileName);
 }
+
+TEST_CASE("decimator", "[recorder]")
+{
+    Decimator dec;
+    const unsigned N = 4;
+
+    // 2 channels, ch1 = -ch0, fed in packs of different sizes
+    std::vector<double> out[6];
+    auto feed = [&](unsigned start, unsigned ns)
+        {
+            SamplePack pack(ns, 2);
+            for (unsigned i = 0; i < ns; i++)
+            {
+                pack.data(0)[i] = start + i;
+                pack.data(1)[i] = -(double)(start + i);
+            }
+            unsigned n = dec.process(pack);
+            for (unsigned co = 0; co < dec.numOutputChannels(2); co++)
+            {
+                out[co].insert(out[co].end(), dec.data(co), dec.data(co) + n);
+            }
+        };
+    auto feedAll = [&]()
+        {
+            for (auto& o : out) o.clear();
+            feed(0, 3);
+            feed(3, 1);
+            feed(4, 10);
+            feed(14, 1);
+            feed(15, 5);
+        };
+
+    dec.setMode(Decimator::KeepNth, N);
+    feedAll();
+    REQUIRE(out[0] == std::vector<double>({0, 4, 8, 12, 16}));
+    REQUIRE(out[1] == std::vector<double>({0, -4, -8, -12, -16}));
+
+    dec.setMode(Decimator::Average, N);
+    feedAll();
+    REQUIRE(out[0] == std::vector<double>({1.5, 5.5, 9.5, 13.5, 17.5}));
+
+    dec.setMode(Decimator::MinMeanMax, N);
+    feedAll();
+    REQUIRE(dec.numOutputChannels(2) == 6);
+    REQUIRE(out[0] == std::vector<double>({0, 4, 8, 12, 16}));
+    REQUIRE(out[1] == std::vector<double>({1.5, 5.5, 9.5, 13.5, 17.5}));
+    REQUIRE(out[2] == std::vector<double>({3, 7, 11, 15, 19}));
+    REQUIRE(out[3] == std::vector<double>({-3, -7, -11, -15, -19}));
+    REQUIRE(out[5] == std::vector<double>({0, -4, -8, -12, -16}));
+}
+
+TEST_CASE("test recording with decimation", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(1, false);
+
+    // temporary file, remove if exists
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    SamplePack samples(5, 1);
+    for (int i = 0; i < 5; i++)
+    {
+        samples.data(0)[i] = i+1;
+    }
+
+    rec.setDecimals(1);
+    rec.setDecimation(Decimator::MinMeanMax, 2);
+    rec.startRecording(fileName, ",", {"Channel 1"}, DataRecorder::TimestampOption::disabled);
+    source._feed(samples);
+    rec.stopRecording();
+
+    QFile recordFile(fileName);
+    REQUIRE(recordFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    REQUIRE((recordFile.readLine() == "Channel 1 (min),Channel 1 (mean),Channel 1 (max)\n"));
+    REQUIRE((recordFile.readLine() == "1.0,1.5,2.0\n"));
+    REQUIRE((recordFile.readLine() == "3.0,3.5,4.0\n"));
+    REQUIRE(recordFile.atEnd());
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("test binary recording", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(2, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    // enough samples for multiple chunks
+    const unsigned N = 200000;
+    SamplePack samples(N, 2);
+    for (unsigned i = 0; i < N; i++)
+    {
+        samples.data(0)[i] = i;
+        samples.data(1)[i] = -0.5 * i;
+    }
+
+    rec.setFormat(DataRecorder::Format::binary64);
+    REQUIRE(rec.startRecording(fileName, ",", {"Channel 1", "Channel 2"},
+                               DataRecorder::TimestampOption::disabled));
+    source._feed(samples);
+    rec.stopRecording();
+
+    QFile recordFile(fileName);
+    REQUIRE(recordFile.open(QIODevice::ReadOnly));
+    REQUIRE(BinaryRecording::isBinaryRecording(&recordFile));
+    recordFile.close();
+
+    BinaryRecordingReader reader;
+    REQUIRE(reader.open(fileName));
+    REQUIRE_FALSE(reader.isIndexRecovered());
+    REQUIRE(reader.channelNames() == QStringList({"Channel 1", "Channel 2"}));
+    REQUIRE(reader.numSamples() == N);
+    REQUIRE(reader.numChunks() > 1);
+
+    std::vector<double> data(N);
+    reader.readChannel(1, 0, N, data.data());
+    for (unsigned i = 0; i < N; i++)
+    {
+        REQUIRE(data[i] == -0.5 * i);
+    }
+
+    // read across the boundary of first and second chunks
+    const unsigned chunkSize = 1024 * 1024 / (2 * 8);
+    reader.readChannel(0, chunkSize - 6, 12, data.data());
+    for (unsigned i = 0; i < 12; i++)
+    {
+        REQUIRE(data[i] == chunkSize - 6 + i);
+    }
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("test recovering truncated binary recording", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(2, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    // 3 full chunks and a partial one
+    const unsigned chunkSize = 1024 * 1024 / (2 * 8);
+    const unsigned N = 3 * chunkSize + 1000;
+    SamplePack samples(N, 2);
+    for (unsigned i = 0; i < N; i++)
+    {
+        samples.data(0)[i] = i;
+        samples.data(1)[i] = -0.5 * i;
+    }
+
+    rec.setFormat(DataRecorder::Format::binary64);
+    REQUIRE(rec.startRecording(fileName, ",", {"Channel 1", "Channel 2"},
+                               DataRecorder::TimestampOption::disabled));
+    source._feed(samples);
+    rec.stopRecording();
+
+    QFile recordFile(fileName);
+    const qint64 indexSize = 4 * 16 + 24;
+    unsigned expected = N;
+    SECTION("missing index")
+    {
+        recordFile.resize(recordFile.size() - indexSize);
+    }
+    SECTION("missing footer only")
+    {
+        recordFile.resize(recordFile.size() - 24);
+    }
+    SECTION("truncated last chunk")
+    {
+        recordFile.resize(recordFile.size() - indexSize - 100);
+        expected = 3 * chunkSize;
+    }
+
+    BinaryRecordingReader reader;
+    REQUIRE(reader.open(fileName));
+    REQUIRE(reader.isIndexRecovered());
+    REQUIRE(reader.numSamples() == expected);
+
+    std::vector<double> data(expected);
+    reader.readChannel(0, 0, expected, data.data());
+    for (unsigned i = 0; i < expected; i++)
+    {
+        REQUIRE(data[i] == i);
+    }
+    reader.readChannel(1, chunkSize - 6, 12, data.data());
+    for (unsigned i = 0; i < 12; i++)
+    {
+        REQUIRE(data[i] == -0.5 * (chunkSize - 6 + i));
+    }
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("unbuffered binary recording shouldn't write tiny chunks", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(2, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    // many small packs, amounts to a few minimum sized chunks
+    const unsigned packSize = 10;
+    const unsigned numPacks = 1000;
+    SamplePack samples(packSize, 2);
+    rec.setFormat(DataRecorder::Format::binary64);
+    rec.disableBuffering = true;
+    REQUIRE(rec.startRecording(fileName, ",", {"Channel 1", "Channel 2"},
+                               DataRecorder::TimestampOption::disabled));
+    for (unsigned p = 0; p < numPacks; p++)
+    {
+        for (unsigned i = 0; i < packSize; i++)
+        {
+            samples.data(0)[i] = p * packSize + i;
+            samples.data(1)[i] = 0;
+        }
+        source._feed(samples);
+    }
+    rec.stopRecording();
+
+    BinaryRecordingReader reader;
+    REQUIRE(reader.open(fileName));
+    REQUIRE(reader.numSamples() == packSize * numPacks);
+    // 160 KB of samples in at least 64 KB chunks
+    REQUIRE(reader.numChunks() <= 3);
+
+    std::vector<double> data(packSize * numPacks);
+    reader.readChannel(0, 0, packSize * numPacks, data.data());
+    for (unsigned i = 0; i < packSize * numPacks; i++)
+    {
+        REQUIRE(data[i] == i);
+    }
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("test recording sync interval", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(1, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    SamplePack samples(2, 1);
+    samples.data(0)[0] = 1;
+    samples.data(0)[1] = 2;
+
+    rec.setDecimals(0);
+    rec.setSyncPolicy(1, 0);
+    rec.startRecording(fileName, ",", {"Channel 1"}, DataRecorder::TimestampOption::disabled);
+    QThread::msleep(5);
+    source._feed(samples);
+
+    // data should be on disk before recording is stopped
+    QFile recordFile(fileName);
+    REQUIRE(recordFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    REQUIRE((recordFile.readAll() == "Channel 1\n1\n2\n"));
+    recordFile.close();
+
+    rec.stopRecording();
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("test recording sync after data stops", "[recorder]")
+{
+    DataRecorder rec;
+    AsyncSink async;
+    TestSource source(1, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    async.connectFollower(&rec);
+    source.connectSink(&async);
+
+    SamplePack samples(2, 1);
+    samples.data(0)[0] = 1;
+    samples.data(0)[1] = 2;
+
+    rec.setDecimals(0);
+    rec.setSyncPolicy(50, 0);
+    rec.startRecording(fileName, ",", {"Channel 1"}, DataRecorder::TimestampOption::disabled);
+    async.setIdleHandler(10, [&rec]() {rec.syncIfDue();});
+    // written before sync interval passes, nothing comes after
+    source._feed(samples);
+
+    QFile recordFile(fileName);
+    REQUIRE(recordFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    QByteArray content;
+    for (int i = 0; i < 100 && content != "Channel 1\n1\n2\n"; i++)
+    {
+        QThread::msleep(10);
+        recordFile.seek(0);
+        content = recordFile.readAll();
+    }
+    REQUIRE((content == "Channel 1\n1\n2\n"));
+    recordFile.close();
+
+    async.flush();
+    async.setIdleHandler(0, {});
+    source.disconnect(&async);
+    rec.stopRecording();
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+/// Delays delivery to following sinks of an `AsyncSink`
+class SlowSink : public Sink
+{
+protected:
+    void feedIn(const SamplePack&) override
+    {
+        QThread::msleep(200);
+    }
+};
+
+TEST_CASE("test background recording timestamps by arrival", "[recorder]")
+{
+    DataRecorder rec;
+    AsyncSink async;
+    SlowSink slow;
+    TestSource source(1, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    // recorder receives packs after the slow sink
+    async.connectFollower(&slow);
+    async.connectFollower(&rec);
+    source.connectSink(&async);
+
+    SamplePack samples(1, 1);
+    samples.data(0)[0] = 1;
+
+    rec.setDecimals(0);
+    rec.setTimeSource([&async]() {return async.packTime();});
+    rec.startRecording(fileName, ",", {}, DataRecorder::TimestampOption::milliseconds);
+    qint64 before = QDateTime::currentMSecsSinceEpoch();
+    source._feed(samples);
+    qint64 after = QDateTime::currentMSecsSinceEpoch();
+    async.flush();
+    source.disconnect(&async);
+    rec.stopRecording();
+
+    QFile recordFile(fileName);
+    REQUIRE(recordFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    auto fields = recordFile.readAll().trimmed().split(',');
+    REQUIRE(fields.size() == 2);
+    qint64 time = fields[0].toLongLong();
+    REQUIRE(time >= before);
+    REQUIRE(time <= after);
+    recordFile.close();
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("csv formatter should match QTextStream", "[recorder]")
+{
+    std::vector<double> values = {0., -0., -0.001, 1., -1., 0.5, 1.5, 2.5, -2.5, 0.125,
+                                  -0.375, 1.005, 9.995, 99.5, 999999.5, 1./3.,
+                                  123.456, 1e20, -1e300, 1e-300, 5e-324,
+                                  4503599627370495.5, std::numeric_limits<double>::max(),
+                                  std::numeric_limits<double>::infinity(),
+                                  -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::quiet_NaN()};
+    for (int i = -2000; i <= 2000; i++) values.push_back(i / 64.);
+
+    for (unsigned decimals = 0; decimals < 10; decimals++)
+    {
+        QString expected;
+        QTextStream stream(&expected);
+        stream.setRealNumberNotation(QTextStream::FixedNotation);
+        stream.setRealNumberPrecision(decimals);
+        for (double v : values) stream << v << ";" << v << "\r\n";
+        stream.flush();
+
+        CsvFormatter csv;
+        csv.setDecimals(decimals);
+        csv.setSeparator(";");
+        csv.setLineEnding("\r\n");
+        const double* columns[2] = {values.data(), values.data()};
+        csv.appendRows(columns, 2, values.size());
+
+        REQUIRE(QByteArray(csv.data(), csv.size()) == expected.toUtf8());
+    }
+}
+
+TEST_CASE("test compressed recording", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(1, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    // enough data for multiple blocks
+    const unsigned numSamples = 500000;
+    SamplePack samples(numSamples, 1);
+    QByteArray expected("Channel 1\n");
+    for (unsigned i = 0; i < numSamples; i++)
+    {
+        samples.data(0)[i] = i;
+        expected += QByteArray::number(i) + "\n";
+    }
+
+    rec.setDecimals(0);
+    rec.setCompression(true);
+    rec.startRecording(fileName, ",", {"Channel 1"}, DataRecorder::TimestampOption::disabled);
+    source._feed(samples);
+    rec.stopRecording();
+
+    REQUIRE(rec.uncompressedBytes() == expected.size());
+    REQUIRE(rec.compressedBytes() < expected.size() / 2);
+
+    {
+        CompressedFile file;
+        file.setFileName(fileName);
+        REQUIRE(file.open(QIODevice::ReadOnly));
+        REQUIRE(file.numBlocks() > 1);
+        REQUIRE(file.size() == expected.size());
+        REQUIRE(file.readAll() == expected);
+
+        // blocks are independent
+        const qint64 pos = CompressedFile::BLOCK_SIZE + 100;
+        REQUIRE(file.seek(pos));
+        REQUIRE(file.read(1000) == expected.mid(pos, 1000));
+        REQUIRE(file.seek(10));
+        REQUIRE(file.read(10) == expected.mid(10, 10));
+    }
+
+    // a truncated file can be read up to the last complete block
+    {
+        QFile rawFile(fileName);
+        REQUIRE(rawFile.resize(rawFile.size() - 10));
+
+        CompressedFile file;
+        file.setFileName(fileName);
+        REQUIRE(file.open(QIODevice::ReadOnly));
+        REQUIRE(file.size() > 0);
+        REQUIRE(file.size() < expected.size());
+        REQUIRE(file.readAll() == expected.left(file.size()));
+    }
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
+
+TEST_CASE("binary recording shouldn't be compressed", "[recorder]")
+{
+    DataRecorder rec;
+    TestSource source(1, false);
+
+    auto fileName = QDir::tempPath() + QString("/" TEST_FILE_NAME);
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+
+    source.connectSink(&rec);
+
+    SamplePack samples(100, 1);
+    for (unsigned i = 0; i < 100; i++) samples.data(0)[i] = i;
+
+    rec.setFormat(DataRecorder::Format::binary32);
+    rec.setCompression(true);
+    REQUIRE(rec.startRecording(fileName, ",", {"Channel 1"},
+                               DataRecorder::TimestampOption::disabled));
+    source._feed(samples);
+    rec.stopRecording();
+
+    // can be loaded as a binary recording
+    BinaryRecordingReader reader;
+    REQUIRE(reader.open(fileName));
+    REQUIRE(reader.numSamples() == 100);
+    std::vector<double> data(100);
+    reader.readChannel(0, 0, 100, data.data());
+    REQUIRE(data[99] == 99);
+
+    if (QFile::exists(fileName)) QFile::remove(fileName);
+}
@@ -0,0 +1,124 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "rowring.h"
+
+#include "catch.hpp"
+
+/// Returns a pack of `ns` samples, channel `ci` sample `i` is `start + i + ci * 1000`
+static SamplePack makePack(unsigned ns, unsigned nc, double start)
+{
+    SamplePack pack(ns, nc);
+    for (unsigned ci = 0; ci < nc; ci++)
+    {
+        for (unsigned i = 0; i < ns; i++)
+        {
+            pack.data(ci)[i] = start + i + ci * 1000;
+        }
+    }
+    return pack;
+}
+
+TEST_CASE("row ring keeps rows in order", "[textview]")
+{
+    RowRing ring(5);
+    REQUIRE(ring.numRows() == 0);
+
+    REQUIRE(ring.append(makePack(3, 2, 0)) == 0);
+    REQUIRE(ring.numChannels() == 2);
+    REQUIRE(ring.numRows() == 3);
+    for (unsigned i = 0; i < 3; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i);
+        REQUIRE(ring.row(i)[1] == i + 1000);
+    }
+}
+
+TEST_CASE("row ring wraps around", "[textview]")
+{
+    RowRing ring(5);
+
+    // rows 0..3, then 4..6 wraps and drops rows 0 and 1
+    ring.append(makePack(4, 2, 0));
+    REQUIRE(ring.append(makePack(3, 2, 4)) == 2);
+    REQUIRE(ring.numRows() == 5);
+    for (unsigned i = 0; i < 5; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i + 2);
+        REQUIRE(ring.row(i)[1] == i + 2 + 1000);
+    }
+
+    // wraps a second time
+    REQUIRE(ring.append(makePack(4, 2, 7)) == 4);
+    for (unsigned i = 0; i < 5; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i + 6);
+    }
+
+    // pack larger than the ring, only the last rows are kept
+    REQUIRE(ring.append(makePack(12, 2, 11)) == 12);
+    REQUIRE(ring.numRows() == 5);
+    for (unsigned i = 0; i < 5; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i + 18);
+        REQUIRE(ring.row(i)[1] == i + 18 + 1000);
+    }
+}
+
+TEST_CASE("row ring resize keeps newest rows", "[textview]")
+{
+    RowRing ring(5);
+    ring.append(makePack(7, 2, 0)); // rows 2..6, head isn't at 0
+
+    ring.setMaxRows(3);
+    REQUIRE(ring.maxRows() == 3);
+    REQUIRE(ring.numRows() == 3);
+    for (unsigned i = 0; i < 3; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i + 4);
+    }
+
+    ring.setMaxRows(10);
+    REQUIRE(ring.numRows() == 3);
+    REQUIRE(ring.append(makePack(2, 2, 7)) == 0);
+    REQUIRE(ring.numRows() == 5);
+    for (unsigned i = 0; i < 5; i++)
+    {
+        REQUIRE(ring.row(i)[0] == i + 4);
+        REQUIRE(ring.row(i)[1] == i + 4 + 1000);
+    }
+}
+
+TEST_CASE("row ring clears on channel count change", "[textview]")
+{
+    RowRing ring(5);
+    ring.append(makePack(4, 2, 0));
+
+    ring.append(makePack(2, 3, 10));
+    REQUIRE(ring.numChannels() == 3);
+    REQUIRE(ring.numRows() == 2);
+    REQUIRE(ring.row(0)[0] == 10);
+    REQUIRE(ring.row(1)[2] == 11 + 2000);
+
+    ring.clear();
+    REQUIRE(ring.numRows() == 0);
+    ring.append(makePack(1, 3, 20));
+    REQUIRE(ring.row(0)[1] == 1020);
+}
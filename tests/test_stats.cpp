@@ -0,0 +1,99 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "runningstats.h"
+
+#include "catch.hpp"
+
+/// Calculates mean and standard deviation of data at once
+static void reference(const std::vector<double>& data, double& mean, double& std)
+{
+    double sum = 0;
+    for (auto x : data) sum += x;
+    mean = sum / data.size();
+
+    double m2 = 0;
+    for (auto x : data) m2 += (x - mean) * (x - mean);
+    std = std::sqrt(m2 / data.size());
+}
+
+TEST_CASE("running statistics", "[stats]")
+{
+    std::vector<double> data;
+    for (unsigned i = 0; i < 1000; i++)
+    {
+        data.push_back(1e6 + std::sin(i * 0.1) * 3 + (i % 7));
+    }
+
+    double mean, std;
+    reference(data, mean, std);
+
+    // results shouldn't depend on how data is split
+    for (unsigned bs : {1, 7, 64, 1000})
+    {
+        RunningStats st;
+        for (unsigned i = 0; i < data.size(); i += bs)
+        {
+            st.addSamples(data.data() + i, std::min(bs, (unsigned) data.size() - i));
+        }
+
+        REQUIRE(st.count() == 1000);
+        REQUIRE(st.mean() == Approx(mean));
+        REQUIRE(st.stdDev() == Approx(std).epsilon(1e-6));
+        REQUIRE(st.rms() == Approx(std::sqrt(mean * mean + std * std)));
+        REQUIRE(st.min() == *std::min_element(data.begin(), data.end()));
+        REQUIRE(st.max() == *std::max_element(data.begin(), data.end()));
+        REQUIRE(st.peakToPeak() == Approx(st.max() - st.min()));
+    }
+
+    RunningStats empty;
+    REQUIRE(empty.count() == 0);
+    REQUIRE(std::isnan(empty.mean()));
+}
+
+TEST_CASE("window statistics", "[stats]")
+{
+    WindowStats ws(128);        // 64 blocks of 2 samples
+
+    std::vector<double> data(1000);
+    for (unsigned i = 0; i < data.size(); i++) data[i] = i;
+
+    ws.addSamples(data.data(), 100);
+    REQUIRE(ws.stats().count() == 100);
+    REQUIRE(ws.stats().min() == 0);
+
+    ws.addSamples(data.data() + 100, 900);
+    auto st = ws.stats();
+    REQUIRE(st.count() == 128);
+    REQUIRE(st.min() == 872);
+    REQUIRE(st.max() == 999);
+    REQUIRE(st.mean() == Approx((872 + 999) / 2.));
+
+    // partial block, window is a little bigger than requested
+    double x = 1000;
+    ws.addSamples(&x, 1);
+    REQUIRE(ws.stats().count() == 129);
+
+    ws.clear();
+    REQUIRE(ws.stats().count() == 0);
+}
@@ -0,0 +1,215 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "trigger.h"
+#include "triggercapture.h"
+
+#include "catch.hpp"
+#include "test_helpers.h"
+
+/// Returns all trigger points of `data` when it's scanned in blocks of `blockSize`
+static std::vector<unsigned> triggerPoints(TriggerDetector& det,
+                                           const std::vector<double>& data,
+                                           unsigned blockSize)
+{
+    std::vector<unsigned> points;
+    unsigned pos = 0;
+    while (pos < data.size())
+    {
+        unsigned n = std::min(blockSize, (unsigned) data.size() - pos);
+        int t = det.scan(data.data() + pos, n);
+        if (t < 0)
+        {
+            pos += n;
+        }
+        else
+        {
+            points.push_back(pos + t);
+            pos += t + 1;
+        }
+    }
+    return points;
+}
+
+TEST_CASE("trigger edge detection with hysteresis", "[trigger]")
+{
+    // rising edge at 10 followed by noise, falling edge at 20, rising edge at 30
+    std::vector<double> data(40, 0);
+    for (unsigned i = 10; i < 20; i++) data[i] = 1;
+    for (unsigned i = 30; i < 40; i++) data[i] = 1;
+    data[12] = 0.45;
+
+    TriggerSpec spec;
+    spec.level = 0.5;
+    spec.hysteresis = 0.2;
+
+    TriggerDetector det;
+    det.setSpec(spec);
+    REQUIRE(triggerPoints(det, data, 100) == std::vector<unsigned>({10, 30}));
+
+    spec.hysteresis = 0;
+    det.setSpec(spec);
+    REQUIRE(triggerPoints(det, data, 100) == std::vector<unsigned>({10, 13, 30}));
+
+    std::vector<double> inverted(data.size());
+    for (unsigned i = 0; i < data.size(); i++) inverted[i] = 1 - data[i];
+    spec.mode = TriggerSpec::FallingEdge;
+    spec.hysteresis = 0.2;
+    det.setSpec(spec);
+    REQUIRE(triggerPoints(det, inverted, 100) == std::vector<unsigned>({10, 30}));
+
+    // result shouldn't depend on block size
+    spec.mode = TriggerSpec::RisingEdge;
+    for (unsigned bs : {1, 3, 7, 16, 17})
+    {
+        det.setSpec(spec);
+        REQUIRE(triggerPoints(det, data, bs) == std::vector<unsigned>({10, 30}));
+    }
+}
+
+TEST_CASE("trigger window and pulse width modes", "[trigger]")
+{
+    std::vector<double> data(100, 0);
+    for (unsigned i = 10; i < 15; i++) data[i] = 1;   // 5 samples wide
+    for (unsigned i = 40; i < 60; i++) data[i] = 1;   // 20 samples wide
+    data[80] = -1;
+
+    TriggerSpec spec;
+    spec.mode = TriggerSpec::PulseWidth;
+    spec.level = 0.5;
+    spec.minWidth = 10;
+    spec.maxWidth = 30;
+
+    TriggerDetector det;
+    for (unsigned bs : {1, 5, 16, 100})
+    {
+        det.setSpec(spec);
+        REQUIRE(triggerPoints(det, data, bs) == std::vector<unsigned>({60}));
+    }
+
+    spec.minWidth = 1;
+    spec.maxWidth = 5;
+    det.setSpec(spec);
+    REQUIRE(triggerPoints(det, data, 100) == std::vector<unsigned>({15}));
+
+    spec.mode = TriggerSpec::Window;
+    spec.level = -0.5;
+    spec.level2 = 0.5;
+    det.setSpec(spec);
+    REQUIRE(triggerPoints(det, data, 100) == std::vector<unsigned>({10, 40, 80}));
+}
+
+TEST_CASE("trigger ignores points before acceptFrom", "[trigger]")
+{
+    std::vector<double> data(64, 0);
+    for (unsigned i = 0; i < data.size(); i += 8)
+    {
+        data[i + 4] = 1;        // rising edges at 4, 12, 20...
+    }
+
+    TriggerSpec spec;
+    spec.level = 0.5;
+    TriggerDetector det;
+    det.setSpec(spec);
+    REQUIRE(det.scan(data.data(), data.size(), 13) == 20);
+    REQUIRE(det.scan(data.data(), data.size(), 64) == -1);
+}
+
+TEST_CASE("trigger capture", "[trigger, stream]")
+{
+    TestSource source(2, false);
+    TriggerCapture capture;
+    source.connectSink(&capture);
+    REQUIRE(capture.numChannels() == 2);
+
+    TriggerSpec spec;
+    spec.level = 50;
+    capture.setSpec(spec);
+    capture.setChannel(1);
+    capture.setNumSamples(20);
+    capture.setPreTrigger(0.25);
+    capture.setSweep(TriggerCapture::Single);
+    capture.setEnabled(true);
+    REQUIRE(capture.state() == TriggerCapture::Armed);
+
+    // channel 1 is a saw tooth with period 100, channel 0 is index
+    const unsigned ns = 7;
+    unsigned index = 0;
+    auto feed = [&](unsigned numPacks)
+        {
+            for (unsigned p = 0; p < numPacks; p++)
+            {
+                SamplePack pack(ns, 2);
+                for (unsigned i = 0; i < ns; i++, index++)
+                {
+                    pack.data(0)[i] = index;
+                    pack.data(1)[i] = index % 100;
+                }
+                source._feed(pack);
+            }
+        };
+
+    feed(8);                    // 56 samples, triggered at 50
+    REQUIRE(capture.state() == TriggerCapture::Capturing);
+    feed(2);
+    REQUIRE(capture.state() == TriggerCapture::Stopped);
+    REQUIRE(capture.triggerPosition() == 5);
+    for (unsigned i = 0; i < 20; i++)
+    {
+        REQUIRE(capture.displayData(0)->sample(i) == 45 + i);
+    }
+
+    // stopped, display is frozen
+    feed(30);
+    REQUIRE(capture.displayData(0)->sample(0) == 45);
+
+    // normal mode, triggers at 350, 450
+    capture.setSweep(TriggerCapture::Normal);
+    capture.arm();
+    feed(30);                   // up to 490
+    REQUIRE(capture.state() == TriggerCapture::Armed);
+    REQUIRE(capture.displayData(0)->sample(0) == 445);
+    REQUIRE(capture.displayData(1)->sample(5) == 50);
+}
+
+TEST_CASE("trigger capture auto mode", "[trigger, stream]")
+{
+    TestSource source(1, false);
+    TriggerCapture capture;
+    source.connectSink(&capture);
+
+    TriggerSpec spec;
+    spec.level = 10;
+    capture.setSpec(spec);
+    capture.setNumSamples(10);
+    capture.setAutoTimeout(0);
+    capture.setEnabled(true);
+
+    // signal never reaches the level, captured anyway
+    SamplePack pack(4, 1);
+    for (unsigned i = 0; i < 4; i++) pack.data(0)[i] = i;
+    source._feed(pack);
+    REQUIRE(capture.state() == TriggerCapture::Armed);
+    REQUIRE(capture.triggerPosition() == -1);
+    REQUIRE(capture.displayData(0)->numValid() == 4);
+    REQUIRE(capture.displayData(0)->sample(9) == 3);
+}
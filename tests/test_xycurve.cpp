@@ -0,0 +1,91 @@
+/*
+  Copyright © 2026 Hasan Yavuz Özderya
+
+  This file is part of serialplot.
+
+  serialplot is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  serialplot is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with serialplot.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <limits>
+
+#include "hitmap.h"
+#include "ringbuffer.h"
+
+#include "catch.hpp"
+
+TEST_CASE("hit map axis mapping", "[xy]")
+{
+    // [0, 10] to pixels [100, 200], grid starts at pixel 100
+    auto axis = HitMap::Axis::fromRange(0, 10, 100, 200, 100);
+    REQUIRE(axis.cell(0) == 0);
+    REQUIRE(axis.cell(0.05) == 0);
+    REQUIRE(axis.cell(0.1) == 1);
+    REQUIRE(axis.cell(5) == 50);
+    REQUIRE(axis.cell(-1) == -10);
+
+    // inverted, like a Y axis
+    auto yAxis = HitMap::Axis::fromRange(0, 10, 99, 0, 0);
+    REQUIRE(yAxis.cell(0) == 99);
+    REQUIRE(yAxis.cell(10) == 0);
+
+    // empty range doesn't produce NaN
+    auto empty = HitMap::Axis::fromRange(5, 5, 0, 10, 0);
+    REQUIRE(empty.cell(5) == 0);
+}
+
+TEST_CASE("hit map counts samples", "[xy]")
+{
+    const unsigned n = 6;
+    RingBuffer x(n), y(n);
+    double xs[n] = {0.5, 0.5, 1.5, 3.5, -1, std::numeric_limits<double>::quiet_NaN()};
+    double ys[n] = {0.5, 0.7, 2.5, 0.5, 0.5, 0.5};
+    x.addSamples(xs, n);
+    y.addSamples(ys, n);
+
+    // unit cells, 3 x 3 grid
+    auto axis = HitMap::Axis::fromRange(0, 1, 0, 1, 0);
+
+    HitMap map;
+    map.reset(3, 3);
+    REQUIRE(map.maxCount() == 0);
+
+    map.add(&x, &y, 0, n, axis, axis);
+    REQUIRE(map.width() == 3);
+    REQUIRE(map.height() == 3);
+    REQUIRE(map.count(0, 0) == 2);
+    REQUIRE(map.count(1, 2) == 1);
+    REQUIRE(map.maxCount() == 2);
+    // outside of grid and NaN are ignored
+    unsigned total = 0;
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 3; c++) total += map.row(r)[c];
+    REQUIRE(total == 3);
+
+    // counts accumulate until reset
+    map.add(&x, &y, 2, 3, axis, axis);
+    REQUIRE(map.count(1, 2) == 2);
+    map.reset(3, 3);
+    REQUIRE(map.count(0, 0) == 0);
+    REQUIRE(map.maxCount() == 0);
+}
+
+TEST_CASE("hit map alpha", "[xy]")
+{
+    REQUIRE(HitMap::alpha(0, 10) == 0);
+    REQUIRE(HitMap::alpha(10, 10) == 255);
+    REQUIRE(HitMap::alpha(1, 1) == 255);
+    int minAlpha = HitMap::MIN_ALPHA;
+    REQUIRE(HitMap::alpha(1, 1000) >= minAlpha);
+    REQUIRE(HitMap::alpha(1, 1000) < HitMap::alpha(100, 1000));
+}